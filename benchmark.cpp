@@ -0,0 +1,593 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <list>
+#include <numeric>
+#include <type_traits>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX // makra 'min' a 'max' z <windows.h> by rozbili 'numeric_limits<...>::max()'
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// hlavickove subory s definiciami vynimkovych tried
+#include "graph_exceptions.h"
+#include "path_exceptions.h"
+
+// graf a generatory syntetickych grafov
+#include "graph.h"
+#include "graph_generators.h"
+
+using namespace std;
+
+// Benchmark operacii grafu na velkych syntetickych grafoch (nahodny G(n,m),
+// R-MAT s mocninovym rozdelenim stupnov a mriezka pripominajuca cestnu siet)
+// v konfiguracii 'GraphAsAdjacencyList' ("default") a
+// 'CompactGraphAsAdjacencyList' ("compact").
+//
+// Pouzitie:
+//		benchmark [pocet vrcholov] [pocet hran] [pocet dopytov] [seed]
+//		benchmark kernels [seed]
+//		benchmark verify [seed]
+//
+// Druhy tvar spusti mikro-benchmark vektorovych jadier z "graph_kernels.h"
+// (skalarna verzia proti AVX2/AVX-512) na vrcholoch s vysokym stupnom.
+// Treti tvar nic nemeria: kontroluje udrziavane najkratsie cesty
+// ('registerSource') proti novemu vypoctu po nahodnych zmenach grafu
+// a pri nezhode skonci s navratovym kodom 1.
+//
+// Vystup je strojovo citatelny: jeden JSON objekt na riadok pre kazdu
+// dvojicu (graf, operacia) s priepustnostou, percentilmi latencie jednej
+// operacie v mikrosekundach a doterajsou spickou pamate procesu v kB.
+// Ak je benchmark skompilovany s -DGRAPH_STATS, kazdy zaznam obsahuje
+// aj sucet statistik grafu za danu operaciu (objekt "stats"); zbieranie
+// statistik sa v benchmarku zapne za behu funkciou 'setStatsEnabled'.
+
+typedef chrono::steady_clock Clock;
+
+// Funkcia vrati spicku pamate procesu (peak RSS) v kB.
+long long peakMemoryKb() {
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters;
+	if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+		return (long long)(counters.PeakWorkingSetSize / 1024);
+	}
+	return 0;
+#else
+	struct rusage usage;
+	if(getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+	return (long long)usage.ru_maxrss / 1024; // na macOS su to bajty
+#else
+	return (long long)usage.ru_maxrss;
+#endif
+#endif
+}
+
+// Struktura 'Measurement' obsahuje namerane latencie jednotlivych
+// operacii a celkovy cas merania.
+struct Measurement {
+	vector<double> latenciesUs; // latencie jednotlivych operacii v mikrosekundach
+	double totalUs = 0; // celkovy cas vsetkych operacii
+
+	// Funkcia odmeria jedno volanie 'op'.
+	void time(const function<void()>& op) {
+		Clock::time_point begin = Clock::now();
+		op();
+		double us = chrono::duration<double, micro>(Clock::now() - begin).count();
+		latenciesUs.push_back(us);
+		totalUs += us;
+	}
+
+	// Funkcia vrati percentil 'p' (0-100) z nameranych latencii.
+	double percentile(double p) const {
+		if(latenciesUs.empty()) return 0;
+		vector<double> sorted = latenciesUs;
+		sort(sorted.begin(), sorted.end());
+		size_t index = (size_t)ceil(p / 100.0 * sorted.size());
+		if(index > 0) index--;
+		return sorted[min(index, sorted.size() - 1)];
+	}
+};
+
+// Struktura 'Record' obsahuje popis jedneho zaznamu benchmarku.
+struct Record {
+	string config; // konfiguracia grafu (typy dlzok a cisel vrcholov)
+	const GeneratedGraph& graph; // vygenerovany graf
+	size_t graphBytes; // odhad pamate grafu po nahrani
+};
+
+// Funkcia vypise jeden zaznam benchmarku ako JSON objekt na jeden riadok.
+// Statistiky grafu 'stats' sa vypisu iba pri zapnutom makre 'GRAPH_STATS'.
+void printRecord(const Record& r, const string& op, const Measurement& m, const QueryStats& stats) {
+	double opsPerSec = m.totalUs > 0 ? m.latenciesUs.size() / (m.totalUs / 1e6) : 0;
+	printf("{\"config\":\"%s\",\"graph\":\"%s\",\"vertices\":%zu,\"edges\":%zu,\"graph_bytes\":%zu,"
+		"\"op\":\"%s\",\"count\":%zu,"
+		"\"total_ms\":%.3f,\"ops_per_sec\":%.1f,\"p50_us\":%.3f,\"p90_us\":%.3f,"
+		"\"p99_us\":%.3f,\"max_us\":%.3f,\"peak_rss_kb\":%lld",
+		r.config.c_str(), r.graph.kind.c_str(), r.graph.vertexCount, r.graph.edges.size(), r.graphBytes,
+		op.c_str(), m.latenciesUs.size(),
+		m.totalUs / 1000.0, opsPerSec, m.percentile(50), m.percentile(90),
+		m.percentile(99), m.percentile(100), peakMemoryKb());
+#ifdef GRAPH_STATS
+	printf(",\"stats\":{\"queries\":%llu,\"vertex_lookups\":%llu,\"edges_scanned\":%llu,"
+		"\"vertices_settled\":%llu,\"heap_pushes\":%llu,\"heap_pops\":%llu,\"allocations\":%llu,"
+		"\"lookup_us\":%.3f,\"traversal_us\":%.3f,\"result_us\":%.3f,\"total_us\":%.3f}",
+		stats.queries, stats.vertexLookups, stats.edgesScanned, stats.verticesSettled,
+		stats.heapPushes, stats.heapPops, stats.allocations,
+		stats.lookupUs, stats.traversalUs, stats.resultUs, stats.totalUs);
+#else
+	(void)stats;
+#endif
+	printf("}\n");
+	fflush(stdout);
+}
+
+// Funkcia vrati oznacenie vrcholu s poradovym cislom 'i' v grafe typu 'Graph'.
+template<class Graph>
+typename Graph::VertexKey generatedVertexKey(size_t i) {
+	if constexpr (is_same<typename Graph::VertexKey, string>::value) return generatedVertexName(i);
+	else return (typename Graph::VertexKey)i;
+}
+
+// Funkcia nahra vygenerovany graf 'g' do grafu typu 'Graph' a odmeria
+// vsetky operacie. Dopytove operacie sa volaju 'queries'-krat (drahe
+// prechody grafom 'traversals'-krat) pre nahodne vybrane vrcholy.
+template<class Graph>
+void runSuite(const string& config, const GeneratedGraph& g, size_t queries, size_t traversals, unsigned seed) {
+	typedef typename Graph::VertexKey Key;
+	Graph graph;
+	graph.setStatsEnabled(true);
+	Record r = { config, g, 0 };
+	mt19937_64 rng(seed);
+	uniform_int_distribution<size_t> pickVertex(0, g.vertexCount == 0 ? 0 : g.vertexCount - 1);
+	uniform_int_distribution<size_t> pickEdge(0, g.edges.empty() ? 0 : g.edges.size() - 1);
+
+	vector<Key> keys;
+	keys.reserve(g.vertexCount);
+	for(size_t i = 0; i < g.vertexCount; i++) keys.push_back(generatedVertexKey<Graph>(i));
+
+	graph.resetStats();
+	Measurement addVertex;
+	for(const Key& v : keys) {
+		addVertex.time([&]() { graph.addVertex(v); });
+	}
+	printRecord(r, "addVertex", addVertex, graph.getTotalStats());
+
+	graph.resetStats();
+	Measurement addEdge;
+	for(const GeneratedEdge& e : g.edges) {
+		addEdge.time([&]() { graph.addEdge(keys[e.from], keys[e.to], e.length); });
+	}
+	r.graphBytes = graph.memoryUsage();
+	printRecord(r, "addEdge", addEdge, graph.getTotalStats());
+
+	if(g.vertexCount == 0) return;
+
+	// polovica dopytov na existujuce hrany, polovica na nahodne dvojice
+	graph.resetStats();
+	Measurement containsEdge;
+	size_t found = 0;
+	for(size_t i = 0; i < queries; i++) {
+		size_t from, to;
+		if(i % 2 == 0 && !g.edges.empty()) {
+			const GeneratedEdge& e = g.edges[pickEdge(rng)];
+			from = e.from;
+			to = e.to;
+		} else {
+			from = pickVertex(rng);
+			to = pickVertex(rng);
+		}
+		containsEdge.time([&]() { found += graph.containsEdge(keys[from], keys[to]); });
+	}
+	printRecord(r, "containsEdge", containsEdge, graph.getTotalStats());
+
+	graph.resetStats();
+	Measurement neighbors;
+	size_t neighborCount = 0;
+	for(size_t i = 0; i < queries; i++) {
+		const Key& v = keys[pickVertex(rng)];
+		neighbors.time([&]() { neighborCount += graph.neighbors(v).size(); });
+	}
+	printRecord(r, "neighbors", neighbors, graph.getTotalStats());
+
+	graph.resetStats();
+	Measurement inDegree;
+	size_t degreeSum = 0;
+	for(size_t i = 0; i < queries; i++) {
+		const Key& v = keys[pickVertex(rng)];
+		inDegree.time([&]() { degreeSum += graph.inDegree(v); });
+	}
+	printRecord(r, "inDegree", inDegree, graph.getTotalStats());
+
+	graph.resetStats();
+	Measurement bfs;
+	size_t visited = 0;
+	for(size_t i = 0; i < traversals; i++) {
+		const Key& v = keys[pickVertex(rng)];
+		bfs.time([&]() { visited += graph.bfs(v).size(); });
+	}
+	printRecord(r, "bfs", bfs, graph.getTotalStats());
+
+	graph.resetStats();
+	Measurement dfs;
+	for(size_t i = 0; i < traversals; i++) {
+		const Key& v = keys[pickVertex(rng)];
+		dfs.time([&]() { visited += graph.dfs(v).size(); });
+	}
+	printRecord(r, "dfs", dfs, graph.getTotalStats());
+
+	// dvojice bez cesty sa meraju tiez, vynimka je sucastou operacie
+	graph.resetStats();
+	Measurement dijkstra;
+	size_t noPath = 0;
+	for(size_t i = 0; i < traversals; i++) {
+		const Key& from = keys[pickVertex(rng)];
+		const Key& to = keys[pickVertex(rng)];
+		dijkstra.time([&]() {
+			try {
+				graph.dijkstra(from, to);
+			}
+			catch(NoPathException &e) {
+				noPath++;
+			}
+		});
+	}
+	printRecord(r, "dijkstra", dijkstra, graph.getTotalStats());
+
+	// udrziavane najkratsie cesty: 'registerSource' je vypocet celeho stromu
+	// (cena prepocitania od nuly), 'setEdgeLength' oprava stromu po zmene
+	// dlzky nahodnej hrany na 0.5 az 2-nasobok povodnej dlzky
+	if(!g.edges.empty()) {
+		graph.resetStats();
+		Measurement registerSource;
+		for(size_t i = 0; i < traversals; i++) {
+			const Key& v = keys[pickVertex(rng)];
+			registerSource.time([&]() { graph.registerSource(v); });
+			graph.unregisterSource(v);
+		}
+		printRecord(r, "registerSource", registerSource, graph.getTotalStats());
+
+		graph.registerSource(keys[g.edges[0].from]);
+		graph.resetStats();
+		Measurement setEdgeLength;
+		uniform_real_distribution<double> pickFactor(0.5, 2.0);
+		for(size_t i = 0; i < queries; i++) {
+			const GeneratedEdge& e = g.edges[pickEdge(rng)];
+			int length = max(1, (int)lround(e.length * pickFactor(rng)));
+			setEdgeLength.time([&]() { graph.setEdgeLength(keys[e.from], keys[e.to], length); });
+		}
+		printRecord(r, "setEdgeLength", setEdgeLength, graph.getTotalStats());
+		graph.unregisterSource(keys[g.edges[0].from]);
+	}
+
+	// odstranovanie ide ako posledne, meni graf; vrcholy sa odstranuju od
+	// najvacsieho cisla, aby v grafe bez nazvov ostali cisla ostatnych platne
+	graph.resetStats();
+	Measurement removeVertex;
+	vector<size_t> toRemove(g.vertexCount);
+	iota(toRemove.begin(), toRemove.end(), (size_t)0);
+	shuffle(toRemove.begin(), toRemove.end(), rng);
+	toRemove.resize(min(toRemove.size(), traversals));
+	sort(toRemove.rbegin(), toRemove.rend());
+	for(size_t v : toRemove) {
+		removeVertex.time([&]() { graph.removeVertex(keys[v]); });
+	}
+	printRecord(r, "removeVertex", removeVertex, graph.getTotalStats());
+
+	// vysledky sa pouziju, aby kompilator dopyty nevyhodil
+	if(found + neighborCount + degreeSum + visited + noPath == (size_t)-1) {
+		cerr << "unreachable" << endl;
+	}
+}
+
+// Funkcia vypise jeden zaznam mikro-benchmarku jadra 'kernel' ako JSON objekt.
+void printKernelRecord(const char* kernel, SimdLevel level, size_t degree, size_t reps,
+	double totalNs, double scalarNs, unsigned long long checksum, bool matchesScalar) {
+	double nsPerCall = totalNs / reps;
+	printf("{\"kernel\":\"%s\",\"level\":\"%s\",\"degree\":%zu,\"reps\":%zu,"
+		"\"ns_per_call\":%.1f,\"edges_per_sec\":%.1f,\"speedup\":%.2f,"
+		"\"checksum\":%llu,\"matches_scalar\":%s}\n",
+		kernel, simdLevelName(level), degree, reps, nsPerCall,
+		nsPerCall > 0 ? degree / (nsPerCall / 1e9) : 0, totalNs > 0 ? scalarNs / totalNs : 0,
+		checksum, matchesScalar ? "true" : "false");
+	fflush(stdout);
+}
+
+// Mikro-benchmark jadier: pre kazdy stupen vrcholu a kazdu uroven
+// podporovanu procesorom odmeria opakovane volanie jadra nad tym istym
+// polom cielov (nahodne rozne vrcholy z 2^20 vrcholov). Jadra, ktore
+// menia stav (navstivene vrcholy, vzdialenosti), ho po kazdom volani
+// vratia do povodneho stavu; obnova je v odmeranom case a je rovnaka
+// pre vsetky urovne. Kontrolny sucet musi byt rovnaky ako pri skalarnej verzii.
+void runKernelBenchmarks(unsigned seed) {
+	const size_t vertexCount = (size_t)1 << 20;
+	const size_t degrees[] = { 16, 256, 4096, 65536 };
+	mt19937_64 rng(seed);
+
+	vector<SimdLevel> levels = { SIMD_SCALAR };
+	SimdLevel best = detectSimdLevel();
+	if(best >= SIMD_AVX2) levels.push_back(SIMD_AVX2);
+	if(best >= SIMD_AVX512) levels.push_back(SIMD_AVX512);
+
+	for(size_t degree : degrees) {
+		// rozne ciele hran a ich dlzky
+		vector<uint32_t> all(vertexCount);
+		iota(all.begin(), all.end(), 0u);
+		shuffle(all.begin(), all.end(), rng);
+		vector<uint32_t> targets(all.begin(), all.begin() + degree);
+		vector<float> lengthsF32(degree);
+		uniform_int_distribution<int> pickLength(1, 100);
+		for(size_t i = 0; i < degree; i++) lengthsF32[i] = (float)pickLength(rng);
+
+		// polovica cielov je uz navstivena (v epoche 1), priblizne stvrtina hran zlepsi vzdialenost
+		const uint32_t base = 1000;
+		vector<uint32_t> visitedInit(vertexCount, 0);
+		vector<float> distF32Init(vertexCount, numeric_limits<float>::max());
+		uniform_int_distribution<uint32_t> pickDistance(base, base + 200);
+		for(size_t i = 0; i < degree; i++) {
+			visitedInit[targets[i]] = (i % 2 == 0);
+			distF32Init[targets[i]] = (float)pickDistance(rng);
+		}
+
+		size_t reps = max<size_t>(16, ((size_t)1 << 22) / degree);
+		vector<uint32_t> out(degree);
+		double scalarNs[3] = { 0, 0, 0 };
+		unsigned long long scalarSum[3] = { 0, 0, 0 };
+
+		for(SimdLevel level : levels) {
+			GraphKernels k = graphKernelsFor(level);
+			vector<uint32_t> visited = visitedInit;
+			vector<float> distF32 = distF32Init;
+			double ns[3];
+			unsigned long long sum[3] = { 0, 0, 0 };
+
+			Clock::time_point begin = Clock::now();
+			for(size_t r = 0; r < reps; r++) {
+				sum[0] += k.countEqual(targets.data(), degree, targets[r % degree]);
+			}
+			ns[0] = chrono::duration<double, nano>(Clock::now() - begin).count();
+
+			begin = Clock::now();
+			for(size_t r = 0; r < reps; r++) {
+				size_t count = k.visitUnvisited(targets.data(), degree, visited.data(), 1, out.data());
+				for(size_t i = 0; i < count; i++) visited[out[i]] = 0;
+				sum[1] += count + (count ? out[count - 1] : 0);
+			}
+			ns[1] = chrono::duration<double, nano>(Clock::now() - begin).count();
+
+			begin = Clock::now();
+			for(size_t r = 0; r < reps; r++) {
+				size_t count = k.relaxF32(targets.data(), lengthsF32.data(), degree, (float)base, distF32.data(), out.data());
+				for(size_t i = 0; i < count; i++) {
+					uint32_t t = targets[out[i]];
+					sum[2] += (unsigned long long)distF32[t];
+					distF32[t] = distF32Init[t];
+				}
+			}
+			ns[2] = chrono::duration<double, nano>(Clock::now() - begin).count();
+
+			if(level == SIMD_SCALAR) {
+				for(int i = 0; i < 3; i++) {
+					scalarNs[i] = ns[i];
+					scalarSum[i] = sum[i];
+				}
+			}
+			const char* names[3] = { "countEqual", "visitUnvisited", "relaxF32" };
+			for(int i = 0; i < 3; i++) {
+				printKernelRecord(names[i], level, degree, reps, ns[i], scalarNs[i], sum[i], sum[i] == scalarSum[i]);
+			}
+		}
+	}
+}
+
+// Funkcia vrati textovu podobu vzdialenosti, ktoru vrati 'distance',
+// alebo "none", ak cesta neexistuje (vynimka 'NoPathException').
+template<class F>
+string distanceOrNone(F distance) {
+	try {
+		return to_string(distance());
+	}
+	catch(NoPathException &e) {
+		return "none";
+	}
+}
+
+// Funkcia porovna udrziavane najkratsie cesty grafu 'graph' zo vsetkych
+// zdrojov 'sources' do vsetkych vrcholov s novym vypoctom: so stromom
+// zdroja zaregistrovaneho znovu na kopii grafu a s funkciou 'dijkstra'.
+// Dlzka cesty 'shortestPath' sa musi rovnat 'shortestDistance'.
+// Pri nezhode vrati false a popis nezhody v 'error'.
+template<class Graph>
+bool checkSources(Graph& graph, const vector<typename Graph::VertexKey>& sources, string& error) {
+	typedef typename Graph::VertexKey Key;
+	vector<Key> keys = graph.getVertexNames();
+	for(const Key& s : sources) {
+		Graph fresh = graph;
+		fresh.unregisterSource(s);
+		fresh.registerSource(s);
+		for(const Key& t : keys) {
+			string maintained = distanceOrNone([&]() { return graph.shortestDistance(s, t); });
+			string recomputed = distanceOrNone([&]() { return fresh.shortestDistance(s, t); });
+			string path = distanceOrNone([&]() { return graph.shortestPath(s, t).getLength(); });
+			string dijkstra = distanceOrNone([&]() { return graph.dijkstra(s, t).getLength(); });
+			if(maintained != recomputed || maintained != path || maintained != dijkstra) {
+				ostringstream out;
+				out << "source " << s << ", target " << t << ": shortestDistance " << maintained <<
+					", registerSource " << recomputed << ", shortestPath " << path << ", dijkstra " << dijkstra;
+				error = out.str();
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+// Funkcia kontroluje udrziavane najkratsie cesty v konfiguracii 'Graph':
+// na malych nahodnych grafoch (dlzky hran 0..20, aj nulove) striedavo
+// pridava, odstranuje a meni dlzky hran, pridava a odstranuje vrcholy
+// (aj zdroje) a registruje a rusi zdroje; po kazdej zmene vola
+// 'checkSources'. Vysledok vypise ako JSON objekt, pri nezhode vypise
+// popis na chybovy vystup a vrati false.
+template<class Graph>
+bool runVerify(const string& config, unsigned seed) {
+	typedef typename Graph::VertexKey Key;
+	const size_t vertexCount = 40, edgeCount = 120, rounds = 5, updates = 300;
+	size_t checks = 0;
+
+	for(size_t round = 0; round < rounds; round++) {
+		mt19937_64 rng(seed + round);
+		uniform_int_distribution<int> pickLength(0, 20);
+		GeneratedGraph g = generateRandomGraph(vertexCount, edgeCount, 20, (unsigned)(seed + round));
+		Graph graph;
+		size_t nextVertex = vertexCount; // poradove cislo dalsieho pridaneho vrcholu
+		for(size_t i = 0; i < vertexCount; i++) graph.addVertex(generatedVertexKey<Graph>(i));
+		for(const GeneratedEdge& e : g.edges) {
+			// neorientovany graf uz moze obsahovat opacnu hranu
+			Key from = generatedVertexKey<Graph>(e.from), to = generatedVertexKey<Graph>(e.to);
+			if(!graph.containsEdge(from, to)) graph.addEdge(from, to, e.length);
+		}
+		vector<Key> sources = { generatedVertexKey<Graph>(0), generatedVertexKey<Graph>(vertexCount / 2) };
+		for(const Key& s : sources) graph.registerSource(s);
+
+		for(size_t update = 0; update < updates; update++) {
+			vector<Key> keys = graph.getVertexNames();
+			const Key& a = keys[rng() % keys.size()];
+			const Key& b = keys[rng() % keys.size()];
+			vector<Key> aNeighbors = graph.neighbors(a);
+			unsigned op = rng() % 100;
+			string opName;
+			if(op < 30) {
+				opName = "addEdge";
+				if(!graph.containsEdge(a, b)) graph.addEdge(a, b, pickLength(rng));
+			} else if(op < 50) {
+				opName = "removeEdge";
+				if(!aNeighbors.empty()) graph.removeEdge(a, aNeighbors[rng() % aNeighbors.size()]);
+			} else if(op < 85) {
+				opName = "setEdgeLength";
+				if(!aNeighbors.empty()) graph.setEdgeLength(a, aNeighbors[rng() % aNeighbors.size()], pickLength(rng));
+			} else if(op < 90) {
+				opName = "addVertex";
+				Key v;
+				if constexpr (is_same<Key, string>::value) v = generatedVertexName(nextVertex++);
+				else v = (Key)graph.vertexCount();
+				graph.addVertex(v);
+				graph.addEdge(a, v, pickLength(rng));
+			} else if(op < 95) {
+				opName = "removeVertex";
+				if(keys.size() <= vertexCount / 2) continue;
+				Key victim = a;
+				graph.removeVertex(victim);
+				sources.erase(remove(sources.begin(), sources.end(), victim), sources.end());
+				// v grafe bez nazvov sa cisla vacsich vrcholov posunu
+				if constexpr (!is_same<Key, string>::value) {
+					for(Key& s : sources) {
+						if(s > victim) s--;
+					}
+				}
+			} else {
+				auto it = find(sources.begin(), sources.end(), a);
+				if(it != sources.end()) {
+					opName = "unregisterSource";
+					graph.unregisterSource(a);
+					sources.erase(it);
+				} else {
+					opName = "registerSource";
+					graph.registerSource(a);
+					sources.push_back(a);
+				}
+			}
+
+			string error;
+			checks++;
+			if(!checkSources(graph, sources, error)) {
+				cerr << "verify " << config << ": round " << round << ", update " << update <<
+					" (" << opName << "): " << error << endl;
+				printf("{\"verify\":\"%s\",\"checks\":%zu,\"ok\":false}\n", config.c_str(), checks);
+				return false;
+			}
+		}
+	}
+	printf("{\"verify\":\"%s\",\"checks\":%zu,\"ok\":true}\n", config.c_str(), checks);
+	fflush(stdout);
+	return true;
+}
+
+// Funkcia spusti kontrolu udrziavanych najkratsich ciest pre orientovane
+// aj neorientovane grafy s nazvami aj bez nazvov. Vrati true, ak vsetky
+// konfiguracie presli.
+bool runVerifyAll(unsigned seed) {
+	bool ok = true;
+	ok = runVerify<GraphAsAdjacencyList>("default", seed) && ok;
+	ok = runVerify<BasicGraphAsAdjacencyList<int, uint32_t, false, true>>("undirected", seed) && ok;
+	ok = runVerify<CompactGraphAsAdjacencyList>("compact", seed) && ok;
+	ok = runVerify<BasicGraphAsAdjacencyList<uint16_t, uint32_t, false, false>>("compact-undirected", seed) && ok;
+	ok = runVerify<BasicGraphAsAdjacencyList<float, uint32_t, false, false>>("float-undirected", seed) && ok;
+	ok = runVerify<BasicGraphAsAdjacencyList<double, uint64_t, true, true>>("double-wide", seed) && ok;
+	return ok;
+}
+
+// Funkcia spusti benchmark pre vsetky druhy grafov v konfiguracii 'Graph'.
+template<class Graph>
+void runAllGraphs(const string& config, size_t vertices, size_t edges, size_t queries, size_t traversals, unsigned seed) {
+	// R-MAT ma 2^scale vrcholov, mriezka side*side
+	unsigned scale = 1;
+	while(((size_t)1 << scale) < vertices) scale++;
+	size_t side = max<size_t>(2, (size_t)sqrt((double)vertices));
+
+	runSuite<Graph>(config, generateRandomGraph(vertices, edges, 100, seed), queries, traversals, seed);
+	runSuite<Graph>(config, generateRmatGraph(scale, edges, 100, seed), queries, traversals, seed);
+	runSuite<Graph>(config, generateGridGraph(side, side, 100, seed), queries, traversals, seed);
+}
+
+int main(int argc, char** argv) {
+	if(argc > 1 && string(argv[1]) == "kernels") {
+		runKernelBenchmarks(argc > 2 ? (unsigned)strtoul(argv[2], nullptr, 10) : 42);
+		return 0;
+	}
+	if(argc > 1 && string(argv[1]) == "verify") {
+		return runVerifyAll(argc > 2 ? (unsigned)strtoul(argv[2], nullptr, 10) : 42) ? 0 : 1;
+	}
+
+	size_t vertices = argc > 1 ? strtoull(argv[1], nullptr, 10) : 2000;
+	size_t edges = argc > 2 ? strtoull(argv[2], nullptr, 10) : 10000;
+	size_t queries = argc > 3 ? strtoull(argv[3], nullptr, 10) : 1000;
+	unsigned seed = argc > 4 ? (unsigned)strtoul(argv[4], nullptr, 10) : 42;
+	size_t traversals = max<size_t>(1, queries / 20);
+
+	try {
+		runAllGraphs<GraphAsAdjacencyList>("default", vertices, edges, queries, traversals, seed);
+		runAllGraphs<CompactGraphAsAdjacencyList>("compact", vertices, edges, queries, traversals, seed);
+	}
+	catch(VertexDuplicateException &ve) {
+		cerr << ve.getDescription() << endl;
+		return 1;
+	}
+	catch(EdgeDuplicateException &ee) {
+		cerr << ee.getDescription() << endl;
+		return 1;
+	}
+	catch(EdgeMissingException &em) {
+		cerr << em.getDescription() << endl;
+		return 1;
+	}
+	catch(VertexMissingException &ve) {
+		cerr << ve.getDescription() << endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,130 @@
+#ifndef EDGE_LIST_H
+#define EDGE_LIST_H
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <limits>
+#include <utility>
+using namespace std;
+
+// Trieda 'EdgeList' reprezentuje zoznam vystupnych hran jedneho vrcholu.
+// Ciele a dlzky hran su v dvoch suvislych poliach (aby ich vektorove
+// jadra mohli nacitat priamo), ale obe polia lezia v jednej alokacii:
+// najprv 'capacity' cielov, za nimi 'capacity' dlzok. Oproti dvom
+// vektorom ma zoznam polovicnu hlavicku (ukazovatel, pocet a kapacita
+// typu 'VertexId', pri 32-bitovych cislach 16 bajtov namiesto 48) a
+// polovicny pocet alokacii.
+//
+// Pocet hran vrcholu sa zmesti do typu 'VertexId', lebo graf zakazuje
+// viacnasobne hrany. 'VertexId' aj 'Weight' su aritmeticke typy, preto
+// sa polia kopiruju cez 'memcpy'.
+template<typename VertexId, typename Weight>
+class EdgeList {
+	char* data = nullptr; // alokacia s poliami cielov a dlzok
+	VertexId count = 0; // pocet hran
+	VertexId capacityCount = 0; // pocet hran, pre ktore je miesto
+
+	// Funkcia vrati posun pola dlzok v alokacii s kapacitou 'cap'.
+	static size_t lengthsOffset(size_t cap) {
+		size_t offset = cap * sizeof(VertexId);
+		return (offset + alignof(Weight) - 1) / alignof(Weight) * alignof(Weight);
+	}
+
+	// Funkcia vrati velkost alokacie s kapacitou 'cap' v bajtoch.
+	static size_t allocationBytes(size_t cap) {
+		return lengthsOffset(cap) + cap * sizeof(Weight);
+	}
+
+	// Funkcia presunie hrany do novej alokacie s kapacitou 'cap' (cap >= count).
+	void reallocate(size_t cap) {
+		char* fresh = (char*)::operator new(allocationBytes(cap));
+		if(this->count > 0) {
+			memcpy(fresh, this->data, this->count * sizeof(VertexId));
+			memcpy(fresh + lengthsOffset(cap), lengths(), this->count * sizeof(Weight));
+		}
+		::operator delete(this->data);
+		this->data = fresh;
+		this->capacityCount = (VertexId)cap;
+	}
+
+public:
+	EdgeList() {}
+
+	EdgeList(const EdgeList& other) {
+		if(other.count > 0) {
+			reallocate(other.count);
+			this->count = other.count;
+			memcpy(targets(), other.targets(), this->count * sizeof(VertexId));
+			memcpy(lengths(), other.lengths(), this->count * sizeof(Weight));
+		}
+	}
+
+	EdgeList(EdgeList&& other) noexcept :
+		data(other.data), count(other.count), capacityCount(other.capacityCount)
+	{
+		other.data = nullptr;
+		other.count = 0;
+		other.capacityCount = 0;
+	}
+
+	EdgeList& operator=(EdgeList other) noexcept {
+		swap(this->data, other.data);
+		swap(this->count, other.count);
+		swap(this->capacityCount, other.capacityCount);
+		return *this;
+	}
+
+	~EdgeList() {
+		::operator delete(this->data);
+	}
+
+	size_t size() const { return this->count; }
+	bool empty() const { return this->count == 0; }
+	size_t capacity() const { return this->capacityCount; }
+
+	// pole cielov hran ('size()' prvkov)
+	VertexId* targets() { return (VertexId*)this->data; }
+	const VertexId* targets() const { return (const VertexId*)this->data; }
+
+	// pole dlzok hran ('size()' prvkov)
+	Weight* lengths() { return (Weight*)(this->data + lengthsOffset(this->capacityCount)); }
+	const Weight* lengths() const { return (const Weight*)(this->data + lengthsOffset(this->capacityCount)); }
+
+	// Funkcia vrati pocet bajtov alokacie zoznamu.
+	size_t memoryUsage() const {
+		return this->data ? allocationBytes(this->capacityCount) : 0;
+	}
+
+	// Funkcia vrati true/false, podla toho, ci 'push_back' bude realokovat.
+	bool full() const {
+		return this->count == this->capacityCount;
+	}
+
+	// Funkcia prida na koniec hranu do 'target' s dlzkou 'length'.
+	// Kapacita sa zdvojnasobuje ako pri vektore.
+	void push_back(VertexId target, Weight length) {
+		if(full()) {
+			size_t cap = this->capacityCount ? 2 * (size_t)this->capacityCount : 1;
+			reallocate(cap < (numeric_limits<VertexId>::max)() ? cap : (numeric_limits<VertexId>::max)());
+		}
+		targets()[this->count] = target;
+		lengths()[this->count] = length;
+		this->count++;
+	}
+
+	// Funkcia odstrani hranu s indexom 'i' (poradie ostatnych sa zachova).
+	void erase(size_t i) {
+		size_t rest = this->count - i - 1;
+		memmove(targets() + i, targets() + i + 1, rest * sizeof(VertexId));
+		memmove(lengths() + i, lengths() + i + 1, rest * sizeof(Weight));
+		this->count--;
+	}
+
+	// Funkcia skrati zoznam na prvych 'n' hran (n <= size()).
+	void truncate(size_t n) {
+		this->count = (VertexId)n;
+	}
+};
+
+#endif // EDGE_LIST_H
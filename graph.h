@@ -0,0 +1,1294 @@
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <string>
+#include <vector>
+#include <list>
+#include <initializer_list>
+#include <utility>
+#include <stack>
+#include <queue>
+#include <unordered_map>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <type_traits>
+#include <cstdint>
+using namespace std;
+
+// vynimky
+#include "graph_exceptions.h"
+#include "path_exceptions.h"
+
+// cesta v grafe
+#include "path.h"
+
+// volitelne statistiky operacii (makro GRAPH_STATS)
+#include "graph_stats.h"
+
+// zoznam hran vrcholu v jednej alokacii
+#include "edge_list.h"
+
+// vektorove jadra vnutornych cyklov
+#include "graph_kernels.h"
+
+// Tema: Graf
+// Typ grafu: orientovany alebo neorientovany, hranovo-ohodnoteny, zakazane
+// viacnasobne hrany a duplicitne vrcholy.
+// Styl implementacie: zoznam susedov (z angl. adjacency list)
+//
+// Graf je sablona s parametrami:
+//		* Weight - typ dlzky hrany (napr. int, uint16_t, uint32_t, float, double);
+//		  celociselny typ ma najviac 32 bitov, aby sa sucty dlzok zmestili do 'long long'
+//		* VertexId - typ cisla vrcholu (uint32_t alebo uint64_t)
+//		* Directed - orientovany (true) alebo neorientovany (false) graf
+//		* Named - vrcholy maju nazvy (true) alebo su to iba cisla 0..n-1 (false)
+// Nepouzite vlastnosti nic nestoja: graf bez nazvov neobsahuje nazvy ani
+// index nazvov a hrany neorientovaneho grafu sa riesia cez 'if constexpr'.
+// Napriklad graf s 32-bitovymi cislami vrcholov a 16-bitovymi dlzkami bez
+// nazvov zabera na hranu 6 bajtov namiesto 32 bajtov uzla zoznamu.
+//
+// Ciele a dlzky hran vrcholu su v dvoch suvislych poliach jednej alokacie
+// ("edge_list.h"), aby sa vnutorne
+// cykly (relaxacia hran, rozsirenie frontu v BFS, vstupny stupen) dali pri
+// 32-bitovych cislach vrcholov pocitat vektorovymi jadrami z "graph_kernels.h".
+// Predvolene je vektorovy iba vstupny stupen, a to pre vrcholy s aspon
+// 'KERNEL_MIN_EDGES' hranami. Relaxacia (pre dlzky typu float) a BFS
+// pouzivaju instrukciu gather, preto su vektorove iba s makrom
+// 'GRAPH_SIMD_GATHER' (bez neho bezia skalarne verzie jadier).
+//
+// Pre zaregistrovane zdroje ('registerSource') graf udrziava stromy
+// najkratsich ciest. Pri pridani, odstraneni a zmene dlzky hrany
+// ('setEdgeLength') sa strom neprepocitava cely, ale opravi sa iba
+// zasiahnuta cast (podla Ramalingama a Repsa): skratenie hrany sa
+// sire Dijkstrovym algoritmom od jej konca, predlzenie alebo odstranenie
+// hrany stromu prepocita iba podstrom pod nou. Orientovany graf si kvoli
+// tomu, kym je zaregistrovany aspon jeden zdroj, pamata aj vstupne hrany.
+// Dlzky hran musia byt nezaporne (rovnako ako pri 'dijkstra').
+
+// Vyhody:
+//		* pridavanie vrcholov je efektivne
+//		* rychle zistenie vsetkych susedov vrcholu
+//		* setri pamat, zabera priestor O(|V|+|E|), matica susednosti zabera O(|V|^2)
+//		* rychly vypocet vystupneho stupna vrcholu
+// Nevyhody:
+//		* odstranenie vrcholu prepocita cisla vrcholov, trva O(|V|+|E|)
+//		* neefektivne zistenie, ci medzi 2 vrcholmi existuje hrana
+
+
+template<typename Weight = int, typename VertexId = uint32_t, bool Directed = true, bool Named = true>
+class BasicGraphAsAdjacencyList {
+	static_assert(is_arithmetic<Weight>::value, "Weight must be an arithmetic type");
+	static_assert(is_floating_point<Weight>::value || sizeof(Weight) <= 4, "integral Weight must have at most 32 bits (distances are long long)");
+	static_assert(is_integral<VertexId>::value && is_unsigned<VertexId>::value, "VertexId must be an unsigned integral type");
+
+public:
+	// typ, ktorym sa vrcholy oznacuju v rozhrani grafu: nazov alebo cislo vrcholu
+	typedef conditional_t<Named, string, VertexId> VertexKey;
+
+	// typ vzdialenosti pri hladani najkratsej cesty; celociselne dlzky sa
+	// scitavaju v 64 bitoch aj pri kratkych dlzkach (napr. 70 000 hran dlzky
+	// 65535 uz presahuje 32 bitov)
+	typedef conditional_t<is_floating_point<Weight>::value, Weight, long long> Distance;
+
+	// cesta v grafe s dlzkami hran typu 'Weight'
+	typedef BasicPath<Weight> PathType;
+
+private:
+	// cislo, ktore neoznacuje ziadny vrchol
+	// ('max' je v zatvorkach, aby ho neprepisalo makro 'max' z <windows.h>)
+	static constexpr VertexId NO_VERTEX = (numeric_limits<VertexId>::max)();
+	// index, ktory neoznacuje ziadnu hranu
+	static constexpr size_t NO_EDGE = (numeric_limits<size_t>::max)();
+	// vzdialenost nedosiahnutelneho vrcholu
+	static constexpr Distance INFINITE_DISTANCE = (numeric_limits<Distance>::max)();
+
+	// vektorove jadra sa daju pouzit iba pre 32-bitove cisla vrcholov
+	static constexpr bool KERNEL_IDS = is_same<VertexId, uint32_t>::value;
+	// najvacsi pocet vrcholov, pre ktory jadra funguju (gather so znamienkovymi indexmi)
+	static constexpr size_t KERNEL_MAX_VERTICES = (size_t)(numeric_limits<int32_t>::max)();
+	// najmensi pocet hran vrcholu, od ktoreho sa oplati volat jadro
+	// (pri mensom stupni jadro neurobi ani jednu celu vektorovu iteraciu)
+	static constexpr size_t KERNEL_MIN_EDGES = 16;
+
+	// vrchol grafu je zoznam jeho vystupnych hran; cislo vrcholu je jeho
+	// poradie vo vektore 'vertices'. Hrana 'i' vedie do vrcholu
+	// 'targets()[i]' a ma dlzku 'lengths()[i]'.
+	typedef EdgeList<VertexId, Weight> Vertex;
+
+	// prazdny typ pre nepouzite cleny (napr. nazvy v grafe bez nazvov)
+	struct Unused {};
+
+	vector<Vertex> vertices; // vsetky vrcholy grafu
+	conditional_t<Named, vector<string>, Unused> names; // nazvy vrcholov podla cisla vrcholu
+	conditional_t<Named, unordered_map<string, VertexId>, Unused> index; // cislo vrcholu podla nazvu
+	size_t edgeTotal = 0; // pocet hran grafu
+
+	// strom najkratsich ciest z jedneho zaregistrovaneho zdroja
+	struct ShortestPathTree {
+		VertexId source; // zdrojovy vrchol
+		vector<Distance> distances; // vzdialenost od zdroja, 'INFINITE_DISTANCE' ak sa vrchol neda dosiahnut
+		vector<VertexId> parents; // predchodca vrcholu v strome, 'NO_VERTEX' pre zdroj a nedosiahnutelne vrcholy
+		vector<Weight> parentLengths; // dlzka hrany od predchodcu
+	};
+
+	vector<ShortestPathTree> trees; // stromy zaregistrovanych zdrojov
+	vector<Vertex> inEdges; // vstupne hrany orientovaneho grafu ('targets' su zaciatky hran), iba ak su zdroje
+	vector<char> affectedMarks; // znacky zasiahnutych vrcholov pocas opravy stromu (inak vsetky false)
+
+	// pomocne polia 'bfs' (zdielane volaniami, preto sa 'bfs' nesmu prekryvat)
+	vector<uint32_t> visitEpochs; // epocha, v ktorej 'bfs' naposledy navstivilo vrchol
+	uint32_t visitEpoch = 0; // epocha posledneho 'bfs'
+	vector<VertexId> bfsQueue; // front pre 'bfs'
+
+#ifdef GRAPH_STATS
+	StatsCollector stats; // statistiky operacii
+#endif
+
+	// Funkcia vrati textovu reprezentaciu oznacenia vrcholu (pre vynimky a vypisy).
+	static string keyToString(const VertexKey& key) {
+		if constexpr (Named) return key;
+		else return to_string(key);
+	}
+
+	// Funkcia vrati oznacenie vrcholu s cislom 'id'.
+	VertexKey keyOf(VertexId id) const {
+		if constexpr (Named) return this->names[id];
+		else return id;
+	}
+
+	// TODO 0.1
+	// Funkcia vrati cislo vrcholu 'vertexName'.
+	// Ak sa dany vrchol v grafe nenajde, vyhodi
+	// sa vynimka typu 'VertexMissingException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//
+	VertexId getVertexId(const VertexKey& vertexName) {
+		VertexId id = findVertexId(vertexName);
+		if(id == NO_VERTEX) throw VertexMissingException(keyToString(vertexName));
+		return id;
+	}
+
+	// Funkcia vrati cislo vrcholu 'vertexName' alebo 'NO_VERTEX',
+	// ak sa dany vrchol v grafe nenachadza (jedno hladanie v indexe).
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	VertexId findVertexId(const VertexKey& vertexName) {
+		GRAPH_STATS_PHASE(lookup);
+		GRAPH_STATS_COUNT(vertexLookups, 1);
+		if constexpr (Named) {
+			auto it = this->index.find(vertexName);
+			if(it != this->index.end()) return it->second;
+		} else {
+			if(vertexName < this->vertices.size()) return vertexName;
+		}
+		return NO_VERTEX;
+	}
+
+	// Funkcia vrati index hrany z vrcholu 'from' do vrcholu 'to'
+	// v zozname hran vrcholu 'from', alebo 'NO_EDGE', ak taka hrana neexistuje.
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	size_t findEdge(VertexId from, VertexId to) {
+		GRAPH_STATS_PHASE(lookup);
+		const Vertex& v = this->vertices[from];
+		const VertexId* targets = v.targets();
+		for(size_t i = 0; i < v.size(); i++) {
+			if(targets[i] == to) {
+				GRAPH_STATS_COUNT(edgesScanned, i + 1);
+				return i;
+			}
+		}
+		GRAPH_STATS_COUNT(edgesScanned, v.size());
+		return NO_EDGE;
+	}
+
+	// TODO 0.2
+	// Funkcia vrati konstantnu referenciu na dlzku vystupnej hrany
+	// z vrcholu 'vertexName1' do vrcholu 'vertexName2'.
+	// Dlzka sa meni iba cez 'setEdgeLength', ktora opravi aj vstupne
+	// hrany a stromy najkratsich ciest.
+	// Ak sa v grafe 'vertexName1' alebo 'vertexName2'
+	// nenachadza, vyhodi sa vynimka typu 'VertexMissingException'.
+	// Ak uvedene vrcholy nie su spojene hranou, vyhodi sa
+	// vynimka typu 'EdgeMissingException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//		* EdgeMissingException
+	const Weight& getEdge(const VertexKey& vertexName1, const VertexKey& vertexName2) {
+		VertexId start = getVertexId(vertexName1);
+		VertexId end = getVertexId(vertexName2);
+
+		size_t i = findEdge(start, end);
+		if(i != NO_EDGE) return this->vertices[start].lengths()[i];
+		throw EdgeMissingException(keyToString(vertexName1), keyToString(vertexName2));
+	}
+
+	// Funkcia vrati, ci graf udrziava zoznamy vstupnych hran.
+	bool hasInEdges() const {
+		return Directed && !this->trees.empty();
+	}
+
+	// Funkcia vrati zoznam vstupnych hran vrcholu 'v' ('targets()' su
+	// zaciatky hran). V neorientovanom grafe su to vystupne hrany.
+	const Vertex& incoming(VertexId v) const {
+		if constexpr (Directed) return this->inEdges[v];
+		else return this->vertices[v];
+	}
+
+	// Funkcia vrati index hrany z vrcholu 'from' v zozname vstupnych hran vrcholu 'to'.
+	size_t findInEdge(VertexId from, VertexId to) const {
+		const Vertex& in = this->inEdges[to];
+		return find(in.targets(), in.targets() + in.size(), from) - in.targets();
+	}
+
+	// Funkcia odstrani hranu s indexom 'i' zo zoznamu hran vrcholu 'from'.
+	void eraseEdge(VertexId from, size_t i) {
+		Vertex& v = this->vertices[from];
+		if(hasInEdges()) {
+			VertexId to = v.targets()[i];
+			this->inEdges[to].erase(findInEdge(from, to));
+		}
+		v.erase(i);
+	}
+
+	// Funkcia prida hranu z vrcholu 'from' do vrcholu 'to' s dlzkou 'length'.
+	void appendEdge(VertexId from, VertexId to, Weight length) {
+		Vertex& v = this->vertices[from];
+		GRAPH_STATS_COUNT(allocations, v.full());
+		v.push_back(to, length);
+		if(hasInEdges()) {
+			Vertex& in = this->inEdges[to];
+			GRAPH_STATS_COUNT(allocations, in.full());
+			in.push_back(from, length);
+		}
+	}
+
+	// Funkcia nastavi dlzku hrany s indexom 'i' zo zoznamu hran vrcholu 'from'.
+	void assignEdgeLength(VertexId from, size_t i, Weight length) {
+		Vertex& v = this->vertices[from];
+		v.lengths()[i] = length;
+		if(hasInEdges()) this->inEdges[v.targets()[i]].lengths()[findInEdge(from, v.targets()[i])] = length;
+	}
+
+	// Funkcia vytvori zoznamy vstupnych hran zo zoznamov vystupnych hran.
+	void buildInEdges() {
+		GRAPH_STATS_COUNT(allocations, this->vertices.size() + 1);
+		this->inEdges.assign(this->vertices.size(), Vertex());
+		for(size_t v = 0; v < this->vertices.size(); v++) {
+			const Vertex& ve = this->vertices[v];
+			GRAPH_STATS_COUNT(edgesScanned, ve.size());
+			for(size_t i = 0; i < ve.size(); i++) {
+				this->inEdges[ve.targets()[i]].push_back((VertexId)v, ve.lengths()[i]);
+			}
+		}
+	}
+
+	// Funkcia zacne nove prehladavanie a vrati jeho epochu: vrchol 'v' je
+	// v nom navstiveny, prave ked visitEpochs[v] == epocha. Predchadzajuce
+	// prehladavania maju mensie epochy, preto sa pole nemusi nulovat
+	// (iba raz za 2^32 prehladavani, ked epocha pretecie).
+	uint32_t nextVisitEpoch() {
+		if(this->visitEpochs.size() < this->vertices.size()) {
+			GRAPH_STATS_COUNT(allocations, 1);
+			this->visitEpochs.resize(this->vertices.size(), 0);
+		}
+		if(++this->visitEpoch == 0) {
+			fill(this->visitEpochs.begin(), this->visitEpochs.end(), 0);
+			this->visitEpoch = 1;
+		}
+		return this->visitEpoch;
+	}
+
+	// Funkcia vrati, ci sa pre graf s 'n' vrcholmi daju pouzit vektorove jadra.
+	static bool useKernels(size_t n) {
+		return KERNEL_IDS && n <= KERNEL_MAX_VERTICES;
+	}
+
+	// Funkcia vrati jadra pre prechod vsetkymi vrcholmi grafu alebo nullptr,
+	// ak sa jadra pouzit nedaju. Vola sa raz na dotaz, nie raz na vrchol.
+	const GraphKernels* kernelsForScan() const {
+		if constexpr (KERNEL_IDS) {
+			if(useKernels(this->vertices.size())) return &graphKernels();
+		}
+		return nullptr;
+	}
+
+	// Funkcia vrati pocet hran vrcholu 'v', ktore vedu do vrcholu 'target'.
+	// Jadro z 'kernels' sa zavola iba pre vrcholy s aspon
+	// 'KERNEL_MIN_EDGES' hranami, kratsie zoznamy su rychlejsie v cykle.
+	static size_t countEdgesTo(const Vertex& v, VertexId target, const GraphKernels* kernels) {
+		if constexpr (KERNEL_IDS) {
+			if(kernels && v.size() >= KERNEL_MIN_EDGES) {
+				return kernels->countEqual(v.targets(), v.size(), target);
+			}
+		}
+		size_t count = 0;
+		for(size_t i = 0; i < v.size(); i++) count += (v.targets()[i] == target);
+		return count;
+	}
+
+	// Funkcia prejde hrany vrcholu 'v' v poradi, kazdy koncovy vrchol,
+	// ktory este nebol navstiveny v epoche 'epoch', oznaci v 'visited'
+	// a zapise do 'out'. Vrati pocet zapisanych vrcholov.
+	size_t visitUnvisited(const Vertex& v, vector<uint32_t>& visited, uint32_t epoch, VertexId* out) {
+		if constexpr (KERNEL_IDS) {
+			if(useKernels(this->vertices.size())) {
+				return graphKernels().visitUnvisited(v.targets(), v.size(), visited.data(), epoch, out);
+			}
+		}
+		size_t k = 0;
+		for(size_t i = 0; i < v.size(); i++) {
+			VertexId t = v.targets()[i];
+			if(visited[t] != epoch) {
+				visited[t] = epoch;
+				out[k++] = t;
+			}
+		}
+		return k;
+	}
+
+	// Funkcia relaxuje hrany vrcholu 'v' so vzdialenostou 'base': kazdu
+	// kratsiu vzdialenost zapise do 'distances' a index hrany prida do
+	// 'improved' (musi mat miesto pre vsetky hrany). Vrati pocet zlepseni.
+	size_t relaxEdges(const Vertex& v, Distance base, vector<Distance>& distances, uint32_t* improved) {
+		size_t n = v.size();
+		const VertexId* targets = v.targets();
+		const Weight* lengths = v.lengths();
+		if constexpr (KERNEL_IDS && is_same<Weight, float>::value && is_same<Distance, float>::value) {
+			if(useKernels(this->vertices.size())) {
+				return graphKernels().relaxF32(targets, lengths, n, base, distances.data(), improved);
+			}
+		}
+		size_t k = 0;
+		for(size_t i = 0; i < n; i++) {
+			Distance candidate = base + (Distance)lengths[i];
+			if(candidate < distances[targets[i]]) {
+				distances[targets[i]] = candidate;
+				improved[k++] = (uint32_t)i;
+			}
+		}
+		return k;
+	}
+
+	// Funkcia vrati strom zaregistrovaneho zdroja 'sourceName'.
+	// Ak vrchol nie je zaregistrovany ako zdroj, vyhodi sa vynimka
+	// typu 'SourceMissingException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//		* SourceMissingException
+	//
+	ShortestPathTree& getTree(const VertexKey& sourceName) {
+		VertexId source = getVertexId(sourceName);
+		for(ShortestPathTree& tree : this->trees) {
+			if(tree.source == source) return tree;
+		}
+		throw SourceMissingException(keyToString(sourceName));
+	}
+
+	// halda s najmensou vzdialenostou navrchu (Dijkstrov algoritmus a oprava stromov)
+	typedef pair<Distance, VertexId> HeapItem;
+	typedef priority_queue<HeapItem, vector<HeapItem>, greater<HeapItem>> Heap;
+
+	// Funkcia dokonci Dijkstrov algoritmus v strome 'tree' z vrcholov v halde
+	// 'heap'. Prechadzaju sa iba vrcholy, ktorych vzdialenost sa skratila.
+	void propagateTree(ShortestPathTree& tree, Heap& heap) {
+		vector<uint32_t> improved; // indexy hran, ktore skratili vzdialenost
+		while(!heap.empty()) {
+			HeapItem item = heap.top();
+			GRAPH_STATS_COUNT(heapPops, 1);
+			heap.pop();
+			VertexId v = item.second;
+			if(item.first > tree.distances[v]) continue; // zastarany zaznam v halde
+			GRAPH_STATS_COUNT(verticesSettled, 1);
+
+			const Vertex& ve = this->vertices[v];
+			GRAPH_STATS_COUNT(edgesScanned, ve.size());
+			if(improved.size() < ve.size()) improved.resize(ve.size());
+			size_t count = relaxEdges(ve, tree.distances[v], tree.distances, improved.data());
+			GRAPH_STATS_COUNT(heapPushes, count);
+			for(size_t k = 0; k < count; k++) {
+				VertexId t = ve.targets()[improved[k]];
+				tree.parents[t] = v;
+				tree.parentLengths[t] = ve.lengths()[improved[k]];
+				heap.push(HeapItem(tree.distances[t], t));
+			}
+		}
+	}
+
+	// Funkcia prida do 'subtree' vrchol 'root' a vsetky vrcholy
+	// pod nim v strome 'tree' ('root' je prvy).
+	void collectSubtree(const ShortestPathTree& tree, VertexId root, vector<VertexId>& subtree) {
+		subtree.push_back(root);
+		for(size_t k = subtree.size() - 1; k < subtree.size(); k++) {
+			VertexId v = subtree[k];
+			const Vertex& ve = this->vertices[v];
+			GRAPH_STATS_COUNT(edgesScanned, ve.size());
+			for(size_t i = 0; i < ve.size(); i++) {
+				if(tree.parents[ve.targets()[i]] == v) subtree.push_back(ve.targets()[i]);
+			}
+		}
+	}
+
+	// Funkcia znovu vypocita vzdialenosti vrcholov 'affected' v strome 'tree'.
+	// Vzdialenosti ostatnych vrcholov musia byt spravne. Kazdy zasiahnuty
+	// vrchol dostane najprv najlepsiu vzdialenost cez vstupnu hranu z
+	// nezasiahnuteho vrcholu a potom sa Dijkstrov algoritmus dokonci
+	// iba medzi zasiahnutymi vrcholmi.
+	void repairTree(ShortestPathTree& tree, const vector<VertexId>& affected) {
+		if(this->affectedMarks.size() < this->vertices.size()) this->affectedMarks.resize(this->vertices.size(), false);
+		for(VertexId v : affected) {
+			this->affectedMarks[v] = true;
+			tree.distances[v] = INFINITE_DISTANCE;
+			tree.parents[v] = NO_VERTEX;
+		}
+
+		Heap heap;
+		for(VertexId v : affected) {
+			const Vertex& in = incoming(v);
+			GRAPH_STATS_COUNT(edgesScanned, in.size());
+			for(size_t i = 0; i < in.size(); i++) {
+				VertexId u = in.targets()[i];
+				if(this->affectedMarks[u] || tree.distances[u] == INFINITE_DISTANCE) continue;
+				Distance d = tree.distances[u] + in.lengths()[i];
+				if(d < tree.distances[v]) {
+					tree.distances[v] = d;
+					tree.parents[v] = u;
+					tree.parentLengths[v] = in.lengths()[i];
+				}
+			}
+			if(tree.distances[v] != INFINITE_DISTANCE) {
+				GRAPH_STATS_COUNT(heapPushes, 1);
+				heap.push(HeapItem(tree.distances[v], v));
+			}
+		}
+		for(VertexId v : affected) this->affectedMarks[v] = false;
+		propagateTree(tree, heap);
+	}
+
+	// Funkcia opravi strom 'tree' po pridani hrany alebo zmene dlzky hrany
+	// z 'from' do 'to' na 'length' (v grafe uz hrana ma novu dlzku).
+	// Ak je hrana v strome a predlzila sa, prepocita sa podstrom pod nou;
+	// inak sa pripadne skratenie cesty do 'to' rozsiri dalej.
+	void edgeChangedInTree(ShortestPathTree& tree, VertexId from, VertexId to, Weight length) {
+		if(tree.parents[to] == from) {
+			if(length == tree.parentLengths[to]) return;
+			if(length > tree.parentLengths[to]) {
+				vector<VertexId> affected;
+				collectSubtree(tree, to, affected);
+				repairTree(tree, affected);
+				return;
+			}
+		}
+		if(tree.distances[from] == INFINITE_DISTANCE) return;
+		Distance d = tree.distances[from] + length;
+		if(d >= tree.distances[to]) return;
+		tree.distances[to] = d;
+		tree.parents[to] = from;
+		tree.parentLengths[to] = length;
+		Heap heap;
+		GRAPH_STATS_COUNT(heapPushes, 1);
+		heap.push(HeapItem(d, to));
+		propagateTree(tree, heap);
+	}
+
+	// Funkcia opravi strom 'tree' po odstraneni hrany z 'from' do 'to'
+	// (v grafe uz hrana nie je). Ak hrana nebola v strome, nic sa nemeni.
+	void edgeRemovedFromTree(ShortestPathTree& tree, VertexId from, VertexId to) {
+		if(tree.parents[to] != from) return;
+		vector<VertexId> affected;
+		collectSubtree(tree, to, affected);
+		repairTree(tree, affected);
+	}
+
+	// Funkcia opravi vsetky stromy po zmene hrany z 'from' do 'to' na 'length'
+	// (v neorientovanom grafe aj opacnej hrany).
+	void edgeChanged(VertexId from, VertexId to, Weight length) {
+		for(ShortestPathTree& tree : this->trees) {
+			edgeChangedInTree(tree, from, to, length);
+			if constexpr (!Directed) {
+				if(from != to) edgeChangedInTree(tree, to, from, length);
+			}
+		}
+	}
+
+	// Funkcia opravi vsetky stromy po odstraneni hrany z 'from' do 'to'
+	// (v neorientovanom grafe aj opacnej hrany).
+	void edgeRemoved(VertexId from, VertexId to) {
+		for(ShortestPathTree& tree : this->trees) {
+			edgeRemovedFromTree(tree, from, to);
+			if constexpr (!Directed) {
+				if(from != to) edgeRemovedFromTree(tree, to, from);
+			}
+		}
+	}
+
+public:
+	// default konstruktor
+	BasicGraphAsAdjacencyList() {
+
+	}
+
+	// Funkcia zapne/vypne zbieranie statistik operacii (implicitne su
+	// vypnute). Bez makra 'GRAPH_STATS' nema ziadny ucinok.
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	void setStatsEnabled(bool enabled) {
+#ifdef GRAPH_STATS
+		this->stats.setEnabled(enabled);
+#else
+		(void)enabled;
+#endif
+	}
+
+	// Funkcia vrati statistiky poslednej operacie grafu. Bez makra
+	// 'GRAPH_STATS' alebo pri vypnutych statistikach ('setStatsEnabled')
+	// sa statistiky nezbieraju a vysledok je prazdny.
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	QueryStats getLastQueryStats() {
+#ifdef GRAPH_STATS
+		return this->stats.getLast();
+#else
+		return QueryStats();
+#endif
+	}
+
+	// Funkcia vrati sucet statistik vsetkych operacii grafu od vytvorenia
+	// grafu alebo od posledneho volania 'resetStats'. Bez makra
+	// 'GRAPH_STATS' je vysledok prazdny.
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	QueryStats getTotalStats() {
+#ifdef GRAPH_STATS
+		return this->stats.getTotal();
+#else
+		return QueryStats();
+#endif
+	}
+
+	// Funkcia vynuluje statistiky grafu.
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	void resetStats() {
+#ifdef GRAPH_STATS
+		this->stats.reset();
+#endif
+	}
+
+	// Funkcia vrati pocet vrcholov grafu.
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	size_t vertexCount() const {
+		return this->vertices.size();
+	}
+
+	// Funkcia vrati pocet hran grafu (hrana neorientovaneho
+	// grafu sa pocita raz).
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	size_t edgeCount() const {
+		return this->edgeTotal;
+	}
+
+	// Funkcia vrati priblizny pocet bajtov, ktore graf zabera v pamati
+	// (vektory vrcholov a hran, nazvy a index nazvov).
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	size_t memoryUsage() const {
+		size_t bytes = sizeof(*this) + this->vertices.capacity() * sizeof(Vertex);
+		for(const Vertex& v : this->vertices) bytes += v.memoryUsage();
+		if constexpr (Named) {
+			bytes += this->names.capacity() * sizeof(string);
+			for(const string& name : this->names) {
+				if(name.capacity() > 15) bytes += name.capacity() + 1; // mimo kratkeho retazca
+			}
+			// uzol hashovacej tabulky (kluc, hodnota, ukazovatel) a buckety
+			bytes += this->index.size() * (sizeof(pair<const string, VertexId>) + sizeof(void*)) +
+				this->index.bucket_count() * sizeof(void*);
+		}
+		bytes += this->trees.capacity() * sizeof(ShortestPathTree) + this->affectedMarks.capacity();
+		for(const ShortestPathTree& tree : this->trees) {
+			bytes += tree.distances.capacity() * sizeof(Distance) + tree.parents.capacity() * sizeof(VertexId) +
+				tree.parentLengths.capacity() * sizeof(Weight);
+		}
+		bytes += this->inEdges.capacity() * sizeof(Vertex);
+		for(const Vertex& v : this->inEdges) bytes += v.memoryUsage();
+		bytes += this->visitEpochs.capacity() * sizeof(uint32_t) + this->bfsQueue.capacity() * sizeof(VertexId);
+		return bytes;
+	}
+
+	// TODO 1
+	// Funkcia vrati true/false, podla toho,
+	// ci vrchol 'vertexName' v grafe existuje/neexistuje.
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	bool containsVertex(const VertexKey& vertexName) {
+		GRAPH_STATS_QUERY("containsVertex");
+		GRAPH_STATS_PHASE(lookup);
+		GRAPH_STATS_COUNT(vertexLookups, 1);
+		if constexpr (Named) return this->index.count(vertexName) > 0;
+		else return vertexName < this->vertices.size();
+	}
+
+	// TODO 2
+	// Funkcia vrati true/false, podla toho,
+	// ci hrana z 'vertexName1' do 'vertexName2' existuje/neexistuje.
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	bool containsEdge(const VertexKey& vertexName1, const VertexKey& vertexName2) {
+		GRAPH_STATS_QUERY("containsEdge");
+		VertexId start = findVertexId(vertexName1);
+		if(start == NO_VERTEX) return false;
+		VertexId end = findVertexId(vertexName2);
+		if(end == NO_VERTEX) return false;
+		return findEdge(start, end) != NO_EDGE;
+	}
+
+	// TODO 3
+	// Funkcia prida vrchol 'vertexName' do grafu.
+	// Ak sa vrchol v grafe uz nachadza, tak vyhodi
+	// vynimku typu 'VertexDuplicateException'.
+	// V grafe bez nazvov su vrcholy cisla 0..n-1, preto sa
+	// s vrcholom 'vertexName' pridaju aj vsetky chybajuce
+	// vrcholy s mensim cislom.
+	// Ak by pocet vrcholov prekrocil rozsah typu 'VertexId',
+	// vyhodi sa vynimka typu 'VertexLimitException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexDuplicateException
+	//		* VertexLimitException
+	//
+	void addVertex(const VertexKey& vertexName) {
+		GRAPH_STATS_QUERY("addVertex");
+		if(containsVertex(vertexName)) {
+			throw VertexDuplicateException(keyToString(vertexName));
+		}
+		if constexpr (Named) {
+			if(this->vertices.size() >= NO_VERTEX) throw VertexLimitException(vertexName);
+			VertexId id = (VertexId)this->vertices.size();
+			GRAPH_STATS_COUNT(allocations, (this->vertices.size() == this->vertices.capacity()) + 1);
+			this->vertices.push_back(Vertex());
+			this->names.push_back(vertexName);
+			this->index.emplace(vertexName, id);
+		} else {
+			if(vertexName >= NO_VERTEX) throw VertexLimitException(keyToString(vertexName));
+			GRAPH_STATS_COUNT(allocations, (size_t)vertexName + 1 > this->vertices.capacity());
+			this->vertices.resize((size_t)vertexName + 1);
+		}
+		if(hasInEdges()) this->inEdges.resize(this->vertices.size());
+		for(ShortestPathTree& tree : this->trees) {
+			tree.distances.resize(this->vertices.size(), INFINITE_DISTANCE);
+			tree.parents.resize(this->vertices.size(), NO_VERTEX);
+			tree.parentLengths.resize(this->vertices.size());
+		}
+	}
+
+	// TODO 4
+	// Funkcia prida hranu z vrcholu 'vertexName1' do
+	// 'vertexName2' s dlzkou 'length'. V neorientovanom
+	// grafe sa prida aj opacna hrana s rovnakou dlzkou.
+	// Ak sa vrchol 'vertexName1' alebo 'vertexName2' v
+	// grafe nenachadza, vyhodi sa vynimka 'VertexMissingException'.
+	// Ak sa taka hrana v grafe uz nachadza, vyhodi sa vynimka
+	// 'EdgeDuplicateException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//		* EdgeDuplicateException
+	void addEdge(const VertexKey& vertexName1, const VertexKey& vertexName2, Weight length) {
+		GRAPH_STATS_QUERY("addEdge");
+		VertexId start = getVertexId(vertexName1);
+		VertexId end = getVertexId(vertexName2);
+
+		if(findEdge(start, end) != NO_EDGE) {
+			throw EdgeDuplicateException(keyToString(vertexName1), keyToString(vertexName2));
+		}
+		appendEdge(start, end, length);
+		if constexpr (!Directed) {
+			if(start != end) appendEdge(end, start, length);
+		}
+		this->edgeTotal++;
+		edgeChanged(start, end, length);
+	}
+
+	// TODO 5
+	// Funkcia, ktora vrati textovu reprezentaciu grafu.
+	// Textova reprezentacia bude obsahovat vsetky vrcholy
+	// grafu a ich zoznam vystupnych hran s uvedenim cieloveho
+	// vrcholu hrany a jej dlzky.
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	string toString() {
+		GRAPH_STATS_QUERY("toString");
+		GRAPH_STATS_PHASE(result);
+		string str;
+		for(size_t v = 0; v < this->vertices.size(); v++) {
+			str += keyToString(keyOf((VertexId)v)) + ": ";
+			const Vertex& ve = this->vertices[v];
+			for(size_t i = 0; i < ve.size(); i++) {
+				GRAPH_STATS_COUNT(edgesScanned, 1);
+				str += keyToString(keyOf(ve.targets()[i])) + "(" + to_string(ve.lengths()[i]) + "), ";
+			}
+			str += "\n";
+		}
+		return str;
+	}
+
+	// TODO 6
+	// Funkcia odstrani vrchol 'vertexName' z grafu.
+	// Funkcia odstrani aj prislusne hrany. Vrcholy s vacsim
+	// cislom sa posunu o jedno nizsie (v grafe bez nazvov
+	// sa teda zmenia ich oznacenia). Ak bol vrchol zaregistrovany
+	// ako zdroj, jeho strom najkratsich ciest sa zrusi; v ostatnych
+	// stromoch sa prepocita podstrom pod odstranenym vrcholom.
+	// Ak sa vrchol v grafe nenachadza, tak vyhodi
+	// vynimku typu 'VertexMissingException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//
+	void removeVertex(const VertexKey& vertexName) {
+		GRAPH_STATS_QUERY("removeVertex");
+		VertexId removed = getVertexId(vertexName);
+
+		GRAPH_STATS_PHASE(traversal);
+		// zasiahnute vrcholy stromov treba zistit skor, nez sa zmenia hrany
+		this->trees.erase(remove_if(this->trees.begin(), this->trees.end(),
+			[removed](const ShortestPathTree& tree) { return tree.source == removed; }), this->trees.end());
+		vector<vector<VertexId>> affected(this->trees.size());
+		for(size_t k = 0; k < this->trees.size(); k++) collectSubtree(this->trees[k], removed, affected[k]);
+
+		// kazda hrana neorientovaneho grafu je aj v zozname odstranovaneho vrcholu
+		this->edgeTotal -= this->vertices[removed].size();
+		for(size_t v = 0; v < this->vertices.size(); v++) {
+			Vertex& ve = this->vertices[v];
+			GRAPH_STATS_COUNT(edgesScanned, ve.size());
+			VertexId* targets = ve.targets();
+			Weight* lengths = ve.lengths();
+			size_t kept = 0;
+			for(size_t i = 0; i < ve.size(); i++) {
+				if(targets[i] == removed) {
+					if constexpr (Directed) {
+						if(v != removed) this->edgeTotal--;
+					}
+					continue;
+				}
+				targets[kept] = targets[i] > removed ? targets[i] - 1 : targets[i];
+				lengths[kept] = lengths[i];
+				kept++;
+			}
+			ve.truncate(kept);
+		}
+		this->vertices.erase(this->vertices.begin() + removed);
+
+		if constexpr (Named) {
+			this->index.erase(this->names[removed]);
+			this->names.erase(this->names.begin() + removed);
+			for(size_t v = removed; v < this->names.size(); v++) this->index[this->names[v]] = (VertexId)v;
+		}
+
+		// stromy: posunu sa cisla vrcholov a prepocitaju sa podstromy pod
+		// odstranenym vrcholom ('affected[k][0]' je samotny odstraneny vrchol)
+		if(hasInEdges()) buildInEdges();
+		else vector<Vertex>().swap(this->inEdges);
+		for(size_t k = 0; k < this->trees.size(); k++) {
+			ShortestPathTree& tree = this->trees[k];
+			if(tree.source > removed) tree.source--;
+			tree.distances.erase(tree.distances.begin() + removed);
+			tree.parents.erase(tree.parents.begin() + removed);
+			tree.parentLengths.erase(tree.parentLengths.begin() + removed);
+			for(VertexId& p : tree.parents) {
+				if(p != NO_VERTEX && p > removed) p--;
+			}
+			vector<VertexId>& subtree = affected[k];
+			subtree.erase(subtree.begin());
+			for(VertexId& v : subtree) {
+				if(v > removed) v--;
+			}
+			repairTree(tree, subtree);
+		}
+	}
+
+	// TODO 7
+	// Funkcia odstrani hranu z 'vertexName1' do 'vertexName2'.
+	// V neorientovanom grafe sa odstrani aj opacna hrana.
+	// Ak sa vrchol 'vertexName1' alebo 'vertexName2' v grafe
+	// nenachadza, tak vyhodi vynimku typu 'VertexMissingException'.
+	// Ak sa hrana z 'vertexName1' do 'vertexName2' v grafe
+	// nenachadza, tak vyhodi vynimku typu 'EdgeMissingException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//		* EdgeMissingException
+	//
+	void removeEdge(const VertexKey& vertexName1, const VertexKey& vertexName2) {
+		GRAPH_STATS_QUERY("removeEdge");
+		VertexId v1 = getVertexId(vertexName1);
+		VertexId v2 = getVertexId(vertexName2);
+
+		size_t i = findEdge(v1, v2);
+		if(i == NO_EDGE) throw EdgeMissingException(keyToString(vertexName1), keyToString(vertexName2));
+		eraseEdge(v1, i);
+		if constexpr (!Directed) {
+			if(v1 != v2) eraseEdge(v2, findEdge(v2, v1));
+		}
+		this->edgeTotal--;
+		edgeRemoved(v1, v2);
+	}
+
+	// TODO 8
+	// Funkcia vrati vektor nazvov susednych vrcholov
+	// vrcholu 'vertexName'. Susedny vrchol je taky,
+	// s ktorym je vrchol 'vertexName' spojeny vystupnou
+	// hranou. Ak sa vrchol 'vertexName' v grafe nenachadza,
+	// vyhodi sa vynimka typu 'VertexMissingException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//
+	vector<VertexKey> neighbors(const VertexKey& vertexName) {
+		GRAPH_STATS_QUERY("neighbors");
+		const Vertex& v = this->vertices[getVertexId(vertexName)];
+		GRAPH_STATS_PHASE(result);
+		GRAPH_STATS_COUNT(allocations, !v.empty());
+		vector<VertexKey> res;
+		res.reserve(v.size());
+		for(size_t i = 0; i < v.size(); i++) { // Prebehnem vsetky hrany incidujuce s vrcholom 'v'
+			GRAPH_STATS_COUNT(edgesScanned, 1);
+			res.push_back(keyOf(v.targets()[i])); // Do resultu pushnem nazov vrchola do ktoreho smeruje hrana s 'v'
+		}
+		return res;
+	}
+
+	// TODO 9
+	// Funkcia, ktora vrati vektor nazvov vsetkych vrcholov v grafe.
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	vector<VertexKey> getVertexNames() {
+		GRAPH_STATS_QUERY("getVertexNames");
+		GRAPH_STATS_PHASE(result);
+		GRAPH_STATS_COUNT(allocations, !this->vertices.empty());
+		if constexpr (Named) {
+			return this->names;
+		} else {
+			vector<VertexKey> res(this->vertices.size());
+			iota(res.begin(), res.end(), (VertexId)0);
+			return res;
+		}
+	}
+
+
+	// TODO 10
+	// Funkcia vrati vstupny stupen vrcholu 'vertexName'.
+	// Vstupny stupen vrcholu hovori kolko hran do neho vstupuje.
+	// V neorientovanom grafe je rovny vystupnemu stupnu.
+	// Ak sa vrchol 'vertexName' v grafe nenachadza,
+	// vyhodi sa vynimka typu 'VertexMissingException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//
+	size_t inDegree(const VertexKey& vertexName) {
+		GRAPH_STATS_QUERY("inDegree");
+		VertexId v = getVertexId(vertexName);
+		if constexpr (!Directed) return this->vertices[v].size();
+
+		GRAPH_STATS_PHASE(traversal);
+		const GraphKernels* kernels = kernelsForScan();
+		size_t degree = 0;
+		for(const Vertex &ve : this->vertices) {
+			GRAPH_STATS_COUNT(edgesScanned, ve.size());
+			degree += countEdgesTo(ve, v, kernels);
+		}
+
+		return degree;
+	}
+
+	// TODO 11
+	// Funkcia vrati vystupny stupen vrcholu 'vertexName'.
+	// Vystupny stupen vrcholu hovori kolko hran z neho vystupuje.
+	// Ak sa vrchol 'vertexName' v grafe nenachadza,
+	// vyhodi sa vynimka typu 'VertexMissingException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//
+	size_t outDegree(const VertexKey& vertexName) {
+		GRAPH_STATS_QUERY("outDegree");
+		return this->vertices[getVertexId(vertexName)].size();
+	}
+
+	// TODO 12
+	// Funkcia vrati postupnost navstivenych vrcholov pocas
+	// prechodu grafom do hlbky z vrcholu 'startVertexName'.
+	// Ak sa vrchol 'startVertexName' v grafe nenachadza,
+	// vyhodi sa vynimka typu 'VertexMissingException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//
+	list<VertexKey> dfs(const VertexKey& startVertexName) {
+		GRAPH_STATS_QUERY("dfs");
+		VertexId start = getVertexId(startVertexName);
+		GRAPH_STATS_PHASE(traversal);
+		GRAPH_STATS_COUNT(allocations, 1); // vektor 'visitedNodes'
+		stack<VertexId, vector<VertexId>> stack;
+		list<VertexKey> res;
+
+		vector<char> visitedNodes(this->vertices.size(), false); // Na zaciatku su vsetky oznacene ako nenavstivene
+
+		stack.push(start);
+		// Klasika z Diskretnej Matematiky :D
+		while(!stack.empty()) {
+			VertexId v = stack.top(); // Ulozim si prvy vrchol v stacku
+			stack.pop();
+			if(!visitedNodes[v]) { // Ak som este nenavstivil 'v'
+				visitedNodes[v] = true; // Tak ho navstivim :D
+				GRAPH_STATS_COUNT(verticesSettled, 1);
+				GRAPH_STATS_COUNT(allocations, 1);
+				res.push_back(keyOf(v)); // A do vlozim ho do vysledku
+
+				const Vertex& ve = this->vertices[v];
+				GRAPH_STATS_COUNT(edgesScanned, ve.size());
+				for(size_t i = 0; i < ve.size(); i++) {
+					if(!visitedNodes[ve.targets()[i]]) stack.push(ve.targets()[i]);
+				}
+			}
+		}
+
+		return res;
+	}
+
+	// TODO 13
+	// Funkcia najde a vrati cestu ('Path') z vrcholu
+	//	'startVertexName' do vrcholu 'endVertexName'
+	// pomocou prehladavania grafu do hlbky (Depth First Search).
+	// Ak sa vrchol 'startVertexName' alebo 'endVertexName'
+	// v grafe nenachadza, vyhodi sa vynimka typu 'VertexMissingException'.
+	// Ak graf neobsahuje cestu z 'startVertexName' do 'endVertexName',
+	// vyhodi sa vynimka typu 'NoPathException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//		* NoPathException
+	//
+	PathType dfs_Path(const VertexKey& startVertexName, const VertexKey& endVertexName) {
+		return PathType();
+	}
+
+	// TODO 14
+	// Funkcia vrati postupnost navstivenych vrcholov pocas
+	// prechodu grafom do sirky z vrcholu 'startVertexName'.
+	// Ak sa vrchol 'startVertexName' v grafe nenachadza,
+	// vyhodi sa vynimka typu 'VertexMissingException'.
+	// Funkcia pouziva pomocne polia grafu ('visitEpochs', 'bfsQueue'),
+	// preto sa volania 'bfs' na jednom grafe nesmu prekryvat
+	// (napr. z viacerych vlakien bez vzajomneho vylucenia).
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//
+	list<VertexKey> bfs(const VertexKey& startVertexName) {
+		GRAPH_STATS_QUERY("bfs");
+		VertexId start = getVertexId(startVertexName);
+		GRAPH_STATS_PHASE(traversal);
+
+		// front je vektor s poradim navstivenia, kazdy vrchol do neho
+		// vstupi najviac raz; 'head' je zaciatok, 'tail' koniec frontu.
+		// Front aj navstivene vrcholy ('visitEpochs') sa pouzivaju opakovane.
+		uint32_t epoch = nextVisitEpoch();
+		if(this->bfsQueue.size() < this->vertices.size()) {
+			GRAPH_STATS_COUNT(allocations, 1);
+			this->bfsQueue.resize(this->vertices.size());
+		}
+		VertexId* q = this->bfsQueue.data();
+		size_t head = 0, tail = 0;
+
+		this->visitEpochs[start] = epoch;
+		q[tail++] = start;
+
+		while(head < tail) {
+			const Vertex& v = this->vertices[q[head++]];
+			GRAPH_STATS_COUNT(verticesSettled, 1);
+			GRAPH_STATS_COUNT(edgesScanned, v.size());
+			tail += visitUnvisited(v, this->visitEpochs, epoch, q + tail);
+		}
+
+		GRAPH_STATS_PHASE(result);
+		GRAPH_STATS_COUNT(allocations, tail);
+		list<VertexKey> res;
+		for(size_t i = 0; i < tail; i++) res.push_back(keyOf(q[i]));
+		return res;
+	}
+
+	// TODO 15
+	// Funkcia najde a vrati cestu ('Path') z vrcholu
+	//	'startVertexName' do vrcholu 'endVertexName'
+	// pomocou prehladavania grafu do sirky (Breadth First Search).
+	// Ak sa vrchol 'startVertexName' alebo 'endVertexName'
+	// v grafe nenachadza, vyhodi sa vynimka typu 'VertexMissingException'.
+	// Ak graf neobsahuje cestu z 'startVertexName' do 'endVertexName',
+	// vyhodi sa vynimka typu 'NoPathException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//		* NoPathException
+	//
+	PathType bfs_Path(const VertexKey& startVertexName, const VertexKey& endVertexName) {
+		return PathType();
+	}
+
+
+	// TODO 16
+	// Funkcia najde najkratsiu cestu z 'startVertexName' do 'endVertexName'.
+	// Ak 'startVertexName' alebo 'endVertexName' neexistuju, vyhodi sa vynimka
+	// typu 'VertexMissingException'. Ak neexistuje medzi nimi cesta, vyhodi sa
+	// 'NoPathException'.
+	PathType dijkstra(const VertexKey& startVertexName, const VertexKey& endVertexName) {
+		GRAPH_STATS_QUERY("dijkstra");
+		VertexId start = getVertexId(startVertexName);
+		VertexId end = getVertexId(endVertexName);
+
+		GRAPH_STATS_PHASE(traversal);
+		GRAPH_STATS_COUNT(allocations, 5); // vektory 'distances', 'predecessors', 'predecessorLengths', 'settledNodes' a 'improved'
+
+		size_t n = this->vertices.size();
+		vector<Distance> distances(n, (numeric_limits<Distance>::max)()); // najkratsia znama vzdialenost od 'start'
+		vector<VertexId> predecessors(n, NO_VERTEX); // predchodca vrcholu na najkratsej ceste
+		vector<Weight> predecessorLengths(n); // dlzka hrany od predchodcu
+		vector<char> settledNodes(n, false); // vrcholy s uz definitivnou vzdialenostou
+		vector<uint32_t> improved; // indexy hran, ktore skratili vzdialenost
+
+		Heap heap;
+		distances[start] = 0;
+		GRAPH_STATS_COUNT(heapPushes, 1);
+		heap.push(HeapItem(0, start));
+
+		while(!heap.empty()) {
+			VertexId v = heap.top().second;
+			GRAPH_STATS_COUNT(heapPops, 1);
+			heap.pop();
+			if(settledNodes[v]) continue; // zastarany zaznam v halde
+			settledNodes[v] = true;
+			GRAPH_STATS_COUNT(verticesSettled, 1);
+			if(v == end) break;
+
+			const Vertex& ve = this->vertices[v];
+			GRAPH_STATS_COUNT(edgesScanned, ve.size());
+			if(improved.size() < ve.size()) improved.resize(ve.size());
+			size_t count = relaxEdges(ve, distances[v], distances, improved.data());
+			GRAPH_STATS_COUNT(heapPushes, count);
+			for(size_t k = 0; k < count; k++) {
+				VertexId t = ve.targets()[improved[k]];
+				predecessors[t] = v;
+				predecessorLengths[t] = ve.lengths()[improved[k]];
+				heap.push(HeapItem(distances[t], t));
+			}
+		}
+
+		if(!settledNodes[end]) {
+			throw NoPathException(keyToString(startVertexName), keyToString(endVertexName));
+		}
+
+		// cestu poskladame odzadu podla predchodcov
+		GRAPH_STATS_PHASE(result);
+		PathType path(keyToString(startVertexName));
+		for(VertexId v = end; v != start; v = predecessors[v]) {
+			GRAPH_STATS_COUNT(allocations, 1);
+			path.addEdgeToFront(keyToString(keyOf(v)), predecessorLengths[v]);
+		}
+		return path;
+	}
+
+
+	// Funkcia vrati dlzku hrany z 'vertexName1' do 'vertexName2'.
+	// Ak sa vrchol 'vertexName1' alebo 'vertexName2' v grafe
+	// nenachadza, vyhodi sa vynimka typu 'VertexMissingException'.
+	// Ak hrana neexistuje, vyhodi sa vynimka 'EdgeMissingException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//		* EdgeMissingException
+	//
+	Weight edgeLength(const VertexKey& vertexName1, const VertexKey& vertexName2) {
+		GRAPH_STATS_QUERY("edgeLength");
+		return getEdge(vertexName1, vertexName2);
+	}
+
+	// Funkcia zmeni dlzku hrany z 'vertexName1' do 'vertexName2'
+	// na 'length' (v neorientovanom grafe aj opacnej hrany) a opravi
+	// stromy najkratsich ciest zaregistrovanych zdrojov.
+	// Ak sa vrchol 'vertexName1' alebo 'vertexName2' v grafe
+	// nenachadza, vyhodi sa vynimka typu 'VertexMissingException'.
+	// Ak hrana neexistuje, vyhodi sa vynimka 'EdgeMissingException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//		* EdgeMissingException
+	//
+	void setEdgeLength(const VertexKey& vertexName1, const VertexKey& vertexName2, Weight length) {
+		GRAPH_STATS_QUERY("setEdgeLength");
+		VertexId v1 = getVertexId(vertexName1);
+		VertexId v2 = getVertexId(vertexName2);
+
+		size_t i = findEdge(v1, v2);
+		if(i == NO_EDGE) throw EdgeMissingException(keyToString(vertexName1), keyToString(vertexName2));
+		GRAPH_STATS_PHASE(traversal);
+		assignEdgeLength(v1, i, length);
+		if constexpr (!Directed) {
+			if(v1 != v2) assignEdgeLength(v2, findEdge(v2, v1), length);
+		}
+		edgeChanged(v1, v2, length);
+	}
+
+	// Funkcia zaregistruje vrchol 'sourceName' ako zdroj: vypocita strom
+	// najkratsich ciest z neho, ktory sa potom pri kazdej zmene hran iba
+	// opravi. Vzdialenosti a cesty sa citaju funkciami 'shortestDistance'
+	// a 'shortestPath'. Ak vrchol neexistuje, vyhodi sa vynimka typu
+	// 'VertexMissingException', ak uz je zaregistrovany, vynimka typu
+	// 'SourceDuplicateException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//		* SourceDuplicateException
+	//
+	void registerSource(const VertexKey& sourceName) {
+		GRAPH_STATS_QUERY("registerSource");
+		VertexId source = getVertexId(sourceName);
+		for(const ShortestPathTree& tree : this->trees) {
+			if(tree.source == source) throw SourceDuplicateException(keyToString(sourceName));
+		}
+
+		GRAPH_STATS_PHASE(traversal);
+		if(Directed && this->trees.empty()) buildInEdges();
+		GRAPH_STATS_COUNT(allocations, 3);
+		size_t n = this->vertices.size();
+		ShortestPathTree tree;
+		tree.source = source;
+		tree.distances.assign(n, INFINITE_DISTANCE);
+		tree.parents.assign(n, NO_VERTEX);
+		tree.parentLengths.resize(n);
+		tree.distances[source] = 0;
+		Heap heap;
+		GRAPH_STATS_COUNT(heapPushes, 1);
+		heap.push(HeapItem(0, source));
+		propagateTree(tree, heap);
+		this->trees.push_back(move(tree));
+	}
+
+	// Funkcia zrusi registraciu zdroja 'sourceName' a jeho strom.
+	// Ak vrchol neexistuje, vyhodi sa vynimka typu 'VertexMissingException',
+	// ak nie je zaregistrovany, vynimka typu 'SourceMissingException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//		* SourceMissingException
+	//
+	void unregisterSource(const VertexKey& sourceName) {
+		GRAPH_STATS_QUERY("unregisterSource");
+		ShortestPathTree& tree = getTree(sourceName);
+		this->trees.erase(this->trees.begin() + (&tree - this->trees.data()));
+		if(this->trees.empty()) vector<Vertex>().swap(this->inEdges);
+	}
+
+	// Funkcia vrati dlzku najkratsej cesty zo zaregistrovaneho zdroja
+	// 'sourceName' do 'targetName' z udrziavaneho stromu (bez prehladavania).
+	// Ak vrchol neexistuje, vyhodi sa vynimka typu 'VertexMissingException',
+	// ak 'sourceName' nie je zaregistrovany zdroj, vynimka typu
+	// 'SourceMissingException'. Ak cesta neexistuje, vyhodi sa 'NoPathException'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//		* SourceMissingException
+	//		* NoPathException
+	//
+	Distance shortestDistance(const VertexKey& sourceName, const VertexKey& targetName) {
+		GRAPH_STATS_QUERY("shortestDistance");
+		const ShortestPathTree& tree = getTree(sourceName);
+		Distance d = tree.distances[getVertexId(targetName)];
+		if(d == INFINITE_DISTANCE) throw NoPathException(keyToString(sourceName), keyToString(targetName));
+		return d;
+	}
+
+	// Funkcia vrati najkratsiu cestu zo zaregistrovaneho zdroja 'sourceName'
+	// do 'targetName' z udrziavaneho stromu (bez prehladavania).
+	// Vynimky su rovnake ako pri funkcii 'shortestDistance'.
+	//
+	// Vyhadzuje vynimky:
+	//		* VertexMissingException
+	//		* SourceMissingException
+	//		* NoPathException
+	//
+	PathType shortestPath(const VertexKey& sourceName, const VertexKey& targetName) {
+		GRAPH_STATS_QUERY("shortestPath");
+		const ShortestPathTree& tree = getTree(sourceName);
+		VertexId end = getVertexId(targetName);
+		if(tree.distances[end] == INFINITE_DISTANCE) {
+			throw NoPathException(keyToString(sourceName), keyToString(targetName));
+		}
+
+		GRAPH_STATS_PHASE(result);
+		PathType path(keyToString(sourceName));
+		for(VertexId v = end; v != tree.source; v = tree.parents[v]) {
+			GRAPH_STATS_COUNT(allocations, 1);
+			path.addEdgeToFront(keyToString(keyOf(v)), tree.parentLengths[v]);
+		}
+		return path;
+	}
+
+
+	// EXTRA uloha
+	// Konstruktor, ktory vytvori graf z dodaneho
+	// inicializacneho zoznamu.
+	//
+	// Format jedneho prvku inicializacneho zoznamu:
+	// {nazov zdrojoveho vrcholu, zoznam vystupnych hran }
+	//
+	// Priklad inicializacneho zoznamu pre graf z webstranky cvicenia:
+	//
+	//	{ "A",	{ {"C", 9}, {"D", 10}, {"F", 14}, {"H", 1}, {"I", 3} } },
+	//	{ "B",	{ {"A", 7} } },
+	//  { "C",	{ {"D", 8} } },
+	//	{ "D",	{ {"A", 2} } },
+	//	{ "E",	{ } },
+	//	{ "F",	{ } },
+	//	{ "G",	{ {"A", 2}, {"F", 4} } },
+	//	{ "H",	{ {"D", 5}, {"G", 3} } },
+	//	{ "I",	{ {"C", 1} } }
+	//
+	// Poznamka: vrcholy uvedene v zozname vystupnych hran budu rovno pridane do grafu.
+	//
+	// Vyhadzuje vynimky: ziadne
+	//
+	BasicGraphAsAdjacencyList(initializer_list<pair<VertexKey, list<pair<VertexKey, Weight>>>> init_list) {
+
+	}
+};
+
+// Povodny graf: orientovany, celociselne dlzky, vrcholy s nazvami.
+typedef BasicGraphAsAdjacencyList<> GraphAsAdjacencyList;
+
+// Kompaktny graf pre velke siete: orientovany, 16-bitove dlzky,
+// 32-bitove cisla vrcholov a vrcholy bez nazvov.
+typedef BasicGraphAsAdjacencyList<uint16_t, uint32_t, true, false> CompactGraphAsAdjacencyList;
+
+#endif // GRAPH_H
@@ -54,4 +54,41 @@ public:
 	string getDescription() { return this->description; }
 };
 
+// Vynimkova trieda pre situaciu, ked sa vrchol
+// 'vertexName' neda pridat, lebo graf uz obsahuje
+// najvacsi mozny pocet vrcholov pre dany typ cisla vrcholu.
+class VertexLimitException {
+private:
+	string description;
+public:
+	VertexLimitException(string vertexName) {
+		description += "\nVertex \'" + vertexName + "\' exceeds the maximum number of vertices.\n";
+	}
+	string getDescription() { return this->description; }
+};
+
+// Vynimkova trieda pre situaciu, ked vrchol 'vertexName'
+// nie je registrovany ako zdroj najkratsich ciest.
+class SourceMissingException {
+private:
+	string description;
+public:
+	SourceMissingException(string vertexName) {
+		description += "\nVertex \'" + vertexName + "\' is not a registered source.\n";
+	}
+	string getDescription() { return this->description; }
+};
+
+// Vynimkova trieda pre situaciu, ked vrchol 'vertexName'
+// uz je registrovany ako zdroj najkratsich ciest.
+class SourceDuplicateException {
+private:
+	string description;
+public:
+	SourceDuplicateException(string vertexName) {
+		description += "\nVertex \'" + vertexName + "\' is already a registered source.\n";
+	}
+	string getDescription() { return this->description; }
+};
+
 #endif // GRAPH_EXCEPTIONS_H
@@ -0,0 +1,146 @@
+#ifndef GRAPH_GENERATORS_H
+#define GRAPH_GENERATORS_H
+
+#include <string>
+#include <vector>
+#include <random>
+#include <unordered_set>
+#include <cstdint>
+#include <cmath>
+using namespace std;
+
+// Synteticke grafy pre benchmark. Generatory vracaju iba zoznam
+// vrcholov a hran, aby sa do grafu dali nahrat rovnako ako v 'main()'
+// (cez 'addVertex' a 'addEdge') a samotne nahravanie sa dalo odmerat.
+// Vsetky generatory vytvaraju graf bez slucok a bez viacnasobnych hran,
+// takze 'addEdge' nikdy nevyhodi 'EdgeDuplicateException'.
+
+// Struktura 'GeneratedEdge' predstavuje jednu vygenerovanu hranu.
+struct GeneratedEdge {
+	size_t from; // poradove cislo zdrojoveho vrcholu
+	size_t to; // poradove cislo cieloveho vrcholu
+	int length; // dlzka hrany
+	GeneratedEdge(size_t from, size_t to, int length) :
+		from(from), to(to), length(length)
+	{}
+};
+
+// Struktura 'GeneratedGraph' predstavuje vygenerovany graf s vrcholmi
+// 0 .. vertexCount-1. Graf s nazvami vrcholov pouzije nazvy z funkcie
+// 'generatedVertexName', graf bez nazvov priamo poradove cisla.
+struct GeneratedGraph {
+	string kind; // druh grafu (random, rmat, grid)
+	size_t vertexCount = 0; // pocet vrcholov
+	vector<GeneratedEdge> edges; // hrany
+};
+
+// Funkcia vrati nazov vrcholu s poradovym cislom 'i'.
+inline string generatedVertexName(size_t i) {
+	return "v" + to_string(i);
+}
+
+// Nahodny graf G(n, m): 'm' roznych hran medzi 'n' vrcholmi vybranych
+// rovnomerne nahodne, dlzky hran su z intervalu <1, maxLength>.
+// Ak je 'm' vacsie ako pocet moznych hran, pouzije sa pocet moznych hran.
+inline GeneratedGraph generateRandomGraph(size_t n, size_t m, int maxLength, unsigned seed) {
+	GeneratedGraph g;
+	g.kind = "random";
+	g.vertexCount = n;
+	if(n < 2) return g;
+
+	size_t maxEdges = n * (n - 1);
+	if(m > maxEdges) m = maxEdges;
+
+	mt19937_64 rng(seed);
+	uniform_int_distribution<size_t> pickVertex(0, n - 1);
+	uniform_int_distribution<int> pickLength(1, maxLength);
+	unordered_set<uint64_t> used; // uz pouzite dvojice (odkial, kam)
+	used.reserve(m);
+	g.edges.reserve(m);
+
+	while(g.edges.size() < m) {
+		size_t from = pickVertex(rng);
+		size_t to = pickVertex(rng);
+		if(from == to) continue;
+		if(!used.insert((uint64_t)from * n + to).second) continue;
+		g.edges.push_back(GeneratedEdge(from, to, pickLength(rng)));
+	}
+	return g;
+}
+
+// R-MAT graf s 2^scale vrcholmi a (najviac) 'm' hranami. Kazda hrana sa
+// vybera rekurzivnym delenim matice susednosti na kvadranty s
+// pravdepodobnostami 'a', 'b', 'c' a 1-a-b-c, vdaka comu maju stupne
+// vrcholov mocninove rozdelenie (par vrcholov s velmi vysokym stupnom).
+// Slucky a duplicitne hrany sa zahadzuju; ak sa po 'm' * 16 pokusoch
+// nepodari vygenerovat 'm' hran, vrati sa mensi graf.
+inline GeneratedGraph generateRmatGraph(unsigned scale, size_t m, int maxLength, unsigned seed,
+	double a = 0.57, double b = 0.19, double c = 0.19) {
+	GeneratedGraph g;
+	g.kind = "rmat";
+	size_t n = (size_t)1 << scale;
+	g.vertexCount = n;
+	if(n < 2) return g;
+
+	mt19937_64 rng(seed);
+	uniform_real_distribution<double> pickQuadrant(0.0, 1.0);
+	uniform_int_distribution<int> pickLength(1, maxLength);
+	unordered_set<uint64_t> used;
+	used.reserve(m);
+	g.edges.reserve(m);
+
+	for(size_t attempts = 0; g.edges.size() < m && attempts < m * 16; attempts++) {
+		size_t from = 0, to = 0;
+		for(unsigned level = 0; level < scale; level++) {
+			double r = pickQuadrant(rng);
+			size_t bit = (size_t)1 << (scale - level - 1);
+			if(r < a) {
+				// lavy horny kvadrant
+			} else if(r < a + b) {
+				to |= bit;
+			} else if(r < a + b + c) {
+				from |= bit;
+			} else {
+				from |= bit;
+				to |= bit;
+			}
+		}
+		if(from == to) continue;
+		if(!used.insert((uint64_t)from * n + to).second) continue;
+		g.edges.push_back(GeneratedEdge(from, to, pickLength(rng)));
+	}
+	return g;
+}
+
+// Mriezka 'rows' x 'cols' pripominajuca cestnu siet. Kazdy vrchol je
+// spojeny so styrmi susedmi v oboch smeroch. Dlzka hrany je zakladna
+// dlzka 'baseLength' nahodne predlzena najviac o polovicu (rozne rychle
+// useky ciest), pricom oba smery jednej ulice maju rovnaku dlzku.
+inline GeneratedGraph generateGridGraph(size_t rows, size_t cols, int baseLength, unsigned seed) {
+	GeneratedGraph g;
+	g.kind = "grid";
+	g.vertexCount = rows * cols;
+
+	mt19937_64 rng(seed);
+	uniform_real_distribution<double> pickFactor(1.0, 1.5);
+	g.edges.reserve(rows * cols * 4);
+
+	for(size_t r = 0; r < rows; r++) {
+		for(size_t c = 0; c < cols; c++) {
+			size_t v = r * cols + c;
+			if(c + 1 < cols) {
+				int length = (int)lround(baseLength * pickFactor(rng));
+				g.edges.push_back(GeneratedEdge(v, v + 1, length));
+				g.edges.push_back(GeneratedEdge(v + 1, v, length));
+			}
+			if(r + 1 < rows) {
+				int length = (int)lround(baseLength * pickFactor(rng));
+				g.edges.push_back(GeneratedEdge(v, v + cols, length));
+				g.edges.push_back(GeneratedEdge(v + cols, v, length));
+			}
+		}
+	}
+	return g;
+}
+
+#endif // GRAPH_GENERATORS_H
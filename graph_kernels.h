@@ -0,0 +1,316 @@
+#ifndef GRAPH_KERNELS_H
+#define GRAPH_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+using namespace std;
+
+// Vektorove (SIMD) jadra vnutornych cyklov grafu nad suvislymi polami
+// cielov a dlzok hran jedneho vrcholu:
+//		* countEqual - pocet vyskytov vrcholu v poli cielov (vstupny stupen)
+//		* visitUnvisited - rozsirenie frontu pri prehladavani do sirky
+//		* relaxF32 - relaxacia hran s dlzkami typu float pri hladani najkratsej cesty
+//
+// Kazde jadro ma skalarnu verziu a verzie pre AVX2 a AVX-512. Verzia sa
+// vyberie za behu podla procesora (funkcia 'graphKernels'). Makro
+// 'GRAPH_NO_SIMD' vektorove verzie vypne uplne.
+//
+// Jadra 'visitUnvisited' a 'relaxF32' citaju navstivene vrcholy a vzdialenosti
+// instrukciou gather z nahodnych adries. Na mnohych procesoroch Intel je
+// gather po mikrokodovej zaplate (GDS) pomalsi ako skalarny cyklus, preto
+// ich graf pouziva iba s makrom 'GRAPH_SIMD_GATHER'; o vhodnosti rozhodne
+// mikro-benchmark ("benchmark kernels") na cielovom stroji.
+//
+// Obmedzenia vektorovych verzii: ciele hran su 32-bitove cisla mensie
+// ako 2^31 (gather pouziva znamienkove indexy) a ciele v jednom poli sa
+// neopakuju (graf zakazuje viacnasobne hrany), takze zapisy do pola
+// vzdialenosti alebo navstivenych vrcholov nie su v konflikte.
+
+#if !defined(GRAPH_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+#define GRAPH_KERNELS_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <immintrin.h>
+#define GRAPH_TARGET_AVX2
+#define GRAPH_TARGET_AVX512
+#define GRAPH_POPCOUNT(x) ((unsigned)__popcnt(x))
+#define GRAPH_CTZ(x) graphCountTrailingZeros(x)
+// Funkcia vrati pocet nulovych bitov na konci nenuloveho cisla 'x'.
+inline unsigned graphCountTrailingZeros(unsigned x) {
+	unsigned long index;
+	_BitScanForward(&index, x);
+	return (unsigned)index;
+}
+#else
+#include <immintrin.h>
+#define GRAPH_TARGET_AVX2 __attribute__((target("avx2")))
+#define GRAPH_TARGET_AVX512 __attribute__((target("avx512f")))
+#define GRAPH_POPCOUNT(x) ((unsigned)__builtin_popcount(x))
+#define GRAPH_CTZ(x) ((unsigned)__builtin_ctz(x))
+#endif
+#endif
+
+// Uroven vektorovych instrukcii, ktoru jadra pouzivaju.
+enum SimdLevel {
+	SIMD_SCALAR,
+	SIMD_AVX2,
+	SIMD_AVX512
+};
+
+// Funkcia vrati nazov urovne vektorovych instrukcii.
+inline const char* simdLevelName(SimdLevel level) {
+	switch(level) {
+	case SIMD_AVX2: return "avx2";
+	case SIMD_AVX512: return "avx512";
+	default: return "scalar";
+	}
+}
+
+// Struktura 'GraphKernels' obsahuje ukazovatele na jadra jednej urovne.
+struct GraphKernels {
+	SimdLevel level;
+
+	// Funkcia vrati, kolko prvkov pola 'targets' dlzky 'n' sa rovna 'value'.
+	size_t (*countEqual)(const uint32_t* targets, size_t n, uint32_t value);
+
+	// Funkcia prejde ciele 'targets' v poradi, kazdy este nenavstiveny
+	// ciel (visited[ciel] != epoch) oznaci ako navstiveny (visited[ciel] = epoch)
+	// a zapise do 'out'. Vrati pocet zapisanych cielov. Vdaka epoche sa pole
+	// 'visited' medzi prehladavaniami nemusi nulovat, staci zvysit 'epoch'.
+	size_t (*visitUnvisited)(const uint32_t* targets, size_t n, uint32_t* visited, uint32_t epoch, uint32_t* out);
+
+	// Funkcia pre kazdu hranu i vypocita kandidata base + lengths[i] a ak je
+	// mensi ako distances[targets[i]], zapise ho tam a index 'i' prida do
+	// 'improved'. Vrati pocet zlepsenych hran (indexy su vzostupne).
+	// Celociselne dlzky nemaju jadro: vzdialenosti su 64-bitove (32-bitovy
+	// sucet by na velkych grafoch pretiekol) a 64-bitovy gather by mal iba
+	// polovicu liniek.
+	size_t (*relaxF32)(const uint32_t* targets, const float* lengths, size_t n,
+		float base, float* distances, uint32_t* improved);
+};
+
+// ---------------------------------------------------------------------
+// Skalarne verzie
+
+inline size_t countEqualScalar(const uint32_t* targets, size_t n, uint32_t value) {
+	size_t count = 0;
+	for(size_t i = 0; i < n; i++) count += (targets[i] == value);
+	return count;
+}
+
+inline size_t visitUnvisitedScalar(const uint32_t* targets, size_t n, uint32_t* visited, uint32_t epoch, uint32_t* out) {
+	size_t k = 0;
+	for(size_t i = 0; i < n; i++) {
+		if(visited[targets[i]] != epoch) {
+			visited[targets[i]] = epoch;
+			out[k++] = targets[i];
+		}
+	}
+	return k;
+}
+
+inline size_t relaxF32Scalar(const uint32_t* targets, const float* lengths, size_t n,
+	float base, float* distances, uint32_t* improved) {
+	size_t k = 0;
+	for(size_t i = 0; i < n; i++) {
+		float candidate = base + lengths[i];
+		if(candidate < distances[targets[i]]) {
+			distances[targets[i]] = candidate;
+			improved[k++] = (uint32_t)i;
+		}
+	}
+	return k;
+}
+
+#ifdef GRAPH_KERNELS_X86
+
+// ---------------------------------------------------------------------
+// AVX2 verzie (8 hran naraz). AVX2 nema scatter, preto sa zlepsene
+// hrany zapisuju po jednej podla bitovej masky.
+
+GRAPH_TARGET_AVX2 inline size_t countEqualAvx2(const uint32_t* targets, size_t n, uint32_t value) {
+	__m256i needle = _mm256_set1_epi32((int)value);
+	size_t count = 0, i = 0;
+	for(; i + 8 <= n; i += 8) {
+		__m256i t = _mm256_loadu_si256((const __m256i*)(targets + i));
+		unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(t, needle)));
+		count += GRAPH_POPCOUNT(mask);
+	}
+	return count + countEqualScalar(targets + i, n - i, value);
+}
+
+GRAPH_TARGET_AVX2 inline size_t visitUnvisitedAvx2(const uint32_t* targets, size_t n, uint32_t* visited, uint32_t epoch, uint32_t* out) {
+	__m256i epochVec = _mm256_set1_epi32((int)epoch);
+	size_t k = 0, i = 0;
+	for(; i + 8 <= n; i += 8) {
+		__m256i t = _mm256_loadu_si256((const __m256i*)(targets + i));
+		__m256i marks = _mm256_i32gather_epi32((const int*)visited, t, 4);
+		unsigned mask = ~(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(marks, epochVec))) & 0xFFu;
+		while(mask) {
+			uint32_t target = targets[i + GRAPH_CTZ(mask)];
+			visited[target] = epoch;
+			out[k++] = target;
+			mask &= mask - 1;
+		}
+	}
+	return k + visitUnvisitedScalar(targets + i, n - i, visited, epoch, out + k);
+}
+
+GRAPH_TARGET_AVX2 inline size_t relaxF32Avx2(const uint32_t* targets, const float* lengths, size_t n,
+	float base, float* distances, uint32_t* improved) {
+	__m256 baseVec = _mm256_set1_ps(base);
+	alignas(32) float candidates[8];
+	size_t k = 0, i = 0;
+	for(; i + 8 <= n; i += 8) {
+		__m256i t = _mm256_loadu_si256((const __m256i*)(targets + i));
+		__m256 candidate = _mm256_add_ps(baseVec, _mm256_loadu_ps(lengths + i));
+		__m256 dist = _mm256_i32gather_ps(distances, t, 4);
+		unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_cmp_ps(candidate, dist, _CMP_LT_OQ));
+		if(!mask) continue;
+		_mm256_store_ps(candidates, candidate);
+		while(mask) {
+			unsigned lane = GRAPH_CTZ(mask);
+			distances[targets[i + lane]] = candidates[lane];
+			improved[k++] = (uint32_t)(i + lane);
+			mask &= mask - 1;
+		}
+	}
+	for(; i < n; i++) {
+		float candidate = base + lengths[i];
+		if(candidate < distances[targets[i]]) {
+			distances[targets[i]] = candidate;
+			improved[k++] = (uint32_t)i;
+		}
+	}
+	return k;
+}
+
+// ---------------------------------------------------------------------
+// AVX-512 verzie (16 hran naraz) so scatter a compress.
+
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC hlasi falosne neinicializovane premenne vo vnutri <immintrin.h>
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+GRAPH_TARGET_AVX512 inline size_t countEqualAvx512(const uint32_t* targets, size_t n, uint32_t value) {
+	__m512i needle = _mm512_set1_epi32((int)value);
+	size_t count = 0, i = 0;
+	for(; i + 16 <= n; i += 16) {
+		__mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512((const void*)(targets + i)), needle);
+		count += GRAPH_POPCOUNT((unsigned)mask);
+	}
+	return count + countEqualScalar(targets + i, n - i, value);
+}
+
+GRAPH_TARGET_AVX512 inline size_t visitUnvisitedAvx512(const uint32_t* targets, size_t n, uint32_t* visited, uint32_t epoch, uint32_t* out) {
+	__m512i epochVec = _mm512_set1_epi32((int)epoch);
+	size_t k = 0, i = 0;
+	for(; i + 16 <= n; i += 16) {
+		__m512i t = _mm512_loadu_si512((const void*)(targets + i));
+		__m512i marks = _mm512_i32gather_epi32(t, (const void*)visited, 4);
+		__mmask16 mask = _mm512_cmpneq_epi32_mask(marks, epochVec);
+		if(!mask) continue;
+		_mm512_mask_i32scatter_epi32((void*)visited, mask, t, epochVec, 4);
+		_mm512_mask_compressstoreu_epi32((void*)(out + k), mask, t);
+		k += GRAPH_POPCOUNT((unsigned)mask);
+	}
+	return k + visitUnvisitedScalar(targets + i, n - i, visited, epoch, out + k);
+}
+
+GRAPH_TARGET_AVX512 inline size_t relaxF32Avx512(const uint32_t* targets, const float* lengths, size_t n,
+	float base, float* distances, uint32_t* improved) {
+	__m512 baseVec = _mm512_set1_ps(base);
+	__m512i lanes = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+	size_t k = 0, i = 0;
+	for(; i + 16 <= n; i += 16) {
+		__m512i t = _mm512_loadu_si512((const void*)(targets + i));
+		__m512 candidate = _mm512_add_ps(baseVec, _mm512_loadu_ps(lengths + i));
+		__m512 dist = _mm512_i32gather_ps(t, (const void*)distances, 4);
+		__mmask16 mask = _mm512_cmp_ps_mask(candidate, dist, _CMP_LT_OQ);
+		if(!mask) continue;
+		_mm512_mask_i32scatter_ps((void*)distances, mask, t, candidate, 4);
+		__m512i index = _mm512_add_epi32(_mm512_set1_epi32((int)i), lanes);
+		_mm512_mask_compressstoreu_epi32((void*)(improved + k), mask, index);
+		k += GRAPH_POPCOUNT((unsigned)mask);
+	}
+	for(; i < n; i++) {
+		float candidate = base + lengths[i];
+		if(candidate < distances[targets[i]]) {
+			distances[targets[i]] = candidate;
+			improved[k++] = (uint32_t)i;
+		}
+	}
+	return k;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // GRAPH_KERNELS_X86
+
+// ---------------------------------------------------------------------
+// Vyber verzie za behu
+
+// Funkcia zisti najvyssiu uroven vektorovych instrukcii, ktoru procesor
+// (a operacny system, ktory uklada registre) podporuje.
+inline SimdLevel detectSimdLevel() {
+#if !defined(GRAPH_KERNELS_X86)
+	return SIMD_SCALAR;
+#elif defined(_MSC_VER) && !defined(__clang__)
+	int info[4];
+	__cpuid(info, 0);
+	if(info[0] < 7) return SIMD_SCALAR;
+	__cpuid(info, 1);
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+	if(!osxsave) return SIMD_SCALAR;
+	unsigned long long xcr0 = _xgetbv(0);
+	__cpuidex(info, 7, 0);
+	bool avx2 = (info[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+	bool avx512 = (info[1] & (1 << 16)) != 0 && (xcr0 & 0xe6) == 0xe6;
+	if(avx512) return SIMD_AVX512;
+	if(avx2) return SIMD_AVX2;
+	return SIMD_SCALAR;
+#else
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx512f")) return SIMD_AVX512;
+	if(__builtin_cpu_supports("avx2")) return SIMD_AVX2;
+	return SIMD_SCALAR;
+#endif
+}
+
+// Funkcia vrati jadra pre uroven 'level'. Ak dana uroven nie je
+// skompilovana, vrati skalarne jadra.
+inline GraphKernels graphKernelsFor(SimdLevel level) {
+#ifdef GRAPH_KERNELS_X86
+	if(level == SIMD_AVX512) {
+		return { SIMD_AVX512, countEqualAvx512, visitUnvisitedAvx512, relaxF32Avx512 };
+	}
+	if(level == SIMD_AVX2) {
+		return { SIMD_AVX2, countEqualAvx2, visitUnvisitedAvx2, relaxF32Avx2 };
+	}
+#else
+	(void)level;
+#endif
+	return { SIMD_SCALAR, countEqualScalar, visitUnvisitedScalar, relaxF32Scalar };
+}
+
+// Funkcia vrati jadra, ktore pouziva graf: najvyssiu uroven podporovanu
+// procesorom, pricom jadra s gather su vektorove iba s makrom
+// 'GRAPH_SIMD_GATHER'. Procesor sa zisti iba pri prvom volani.
+inline const GraphKernels& graphKernels() {
+	static const GraphKernels kernels = []() {
+		GraphKernels k = graphKernelsFor(detectSimdLevel());
+#ifndef GRAPH_SIMD_GATHER
+		GraphKernels scalar = graphKernelsFor(SIMD_SCALAR);
+		k.visitUnvisited = scalar.visitUnvisited;
+		k.relaxF32 = scalar.relaxF32;
+#endif
+		return k;
+	}();
+	return kernels;
+}
+
+#endif // GRAPH_KERNELS_H
@@ -0,0 +1,162 @@
+#ifndef GRAPH_STATS_H
+#define GRAPH_STATS_H
+
+#include <string>
+#include <chrono>
+using namespace std;
+
+// Statistiky operacii grafu. Instrumentacia je volitelna na dvoch urovniach:
+//		* makro 'GRAPH_STATS' (pred vlozenim "graph.h" alebo prepinac
+//		  kompilatora -DGRAPH_STATS) ju prelozi do grafu. Bez neho sa vsetky
+//		  makra GRAPH_STATS_* rozvinu na nic a graf neobsahuje ziadne pocitadla
+//		  (vhodne pre release).
+//		* za behu sa zbieranie zapina funkciou grafu 'setStatsEnabled'
+//		  (implicitne je vypnute). Vypnute statistiky stoja iba kontrolu
+//		  priznaku, nemeria sa cas ani nepocitaju pocitadla, takze sa daju
+//		  zapnut iba pocas skumania pomalych dopytov.
+
+// Struktura 'QueryStats' obsahuje pocitadla a casy jednej operacie,
+// pripadne sucet viacerych operacii (vtedy 'queries' > 1).
+struct QueryStats {
+	string operation; // nazov operacie (pri suctoch posledna operacia)
+	unsigned long long queries = 0; // pocet zapocitanych operacii
+	unsigned long long vertexLookups = 0; // vyhladania vrcholu podla nazvu
+	unsigned long long edgesScanned = 0; // prezrete hrany
+	unsigned long long verticesSettled = 0; // navstivene/uzavrete vrcholy
+	unsigned long long heapPushes = 0; // vlozenia do haldy
+	unsigned long long heapPops = 0; // vybratia z haldy
+	unsigned long long allocations = 0; // nove uzly zoznamov/map a realokacie vektorov
+	double lookupUs = 0; // cas vyhladavania vrcholov a hran
+	double traversalUs = 0; // cas prechodu grafom
+	double resultUs = 0; // cas skladania vysledku
+	double totalUs = 0; // celkovy cas operacie
+
+	// Funkcia pripocita statistiky 'other'.
+	void add(const QueryStats& other) {
+		operation = other.operation;
+		queries += other.queries;
+		vertexLookups += other.vertexLookups;
+		edgesScanned += other.edgesScanned;
+		verticesSettled += other.verticesSettled;
+		heapPushes += other.heapPushes;
+		heapPops += other.heapPops;
+		allocations += other.allocations;
+		lookupUs += other.lookupUs;
+		traversalUs += other.traversalUs;
+		resultUs += other.resultUs;
+		totalUs += other.totalUs;
+	}
+
+	// Funkcia vrati textovu reprezentaciu statistik.
+	string toString() const {
+		return operation + ": queries=" + to_string(queries) +
+			" vertexLookups=" + to_string(vertexLookups) +
+			" edgesScanned=" + to_string(edgesScanned) +
+			" verticesSettled=" + to_string(verticesSettled) +
+			" heapPushes=" + to_string(heapPushes) +
+			" heapPops=" + to_string(heapPops) +
+			" allocations=" + to_string(allocations) +
+			" lookupUs=" + to_string(lookupUs) +
+			" traversalUs=" + to_string(traversalUs) +
+			" resultUs=" + to_string(resultUs) +
+			" totalUs=" + to_string(totalUs);
+	}
+};
+
+#ifdef GRAPH_STATS
+
+// Trieda 'StatsCollector' zbiera statistiky prave beziacej operacie
+// a ich sucet za cely graf. Operacie grafu sa mozu volat navzajom
+// (napr. 'addEdge' vola 'containsEdge'), preto sa pocita hlbka vnorenia
+// a za operaciu sa povazuje iba to najvonkajsie volanie. Casy faz su
+// vylucne: pri vstupe do vnorenej fazy sa cas vonkajsej fazy zastavi.
+class StatsCollector {
+	typedef chrono::steady_clock Clock;
+
+	QueryStats last; // statistiky poslednej (alebo prave beziacej) operacie
+	QueryStats total; // sucet statistik vsetkych operacii
+	int depth = 0; // hlbka vnorenia operacii
+	Clock::time_point queryStart; // zaciatok najvonkajsej operacie
+	double QueryStats::* currentPhase = nullptr; // prave merana faza
+	Clock::time_point phaseStart; // zaciatok merania aktualnej fazy
+	bool enabled = false; // zbieraju sa statistiky?
+public:
+	// Funkcia zapne/vypne zbieranie statistik. Vola sa iba mimo operacie grafu.
+	void setEnabled(bool value) { enabled = value; }
+	bool isEnabled() const { return enabled; }
+
+	// Funkcia zacne operaciu 'operation'.
+	void beginQuery(const char* operation) {
+		if(depth++ > 0) return;
+		last = QueryStats();
+		last.operation = operation;
+		last.queries = 1;
+		currentPhase = nullptr;
+		queryStart = Clock::now();
+	}
+
+	// Funkcia ukonci operaciu a pripocita ju k suctu za graf.
+	void endQuery() {
+		if(--depth > 0) return;
+		switchPhase(nullptr);
+		last.totalUs = chrono::duration<double, micro>(Clock::now() - queryStart).count();
+		total.add(last);
+	}
+
+	// Funkcia prepne meranu fazu na 'phase' a vrati predchadzajucu fazu.
+	double QueryStats::* switchPhase(double QueryStats::* phase) {
+		Clock::time_point now = Clock::now();
+		if(currentPhase) last.*currentPhase += chrono::duration<double, micro>(now - phaseStart).count();
+		double QueryStats::* previous = currentPhase;
+		currentPhase = phase;
+		phaseStart = now;
+		return previous;
+	}
+
+	QueryStats& current() { return last; }
+	const QueryStats& getLast() const { return last; }
+	const QueryStats& getTotal() const { return total; }
+	void reset() { last = QueryStats(); total = QueryStats(); }
+};
+
+// Pomocna struktura, ktora pocas svojej existencie meria jednu operaciu
+// (ukonci ju aj pri vyhodeni vynimky). Pri vypnutych statistikach nerobi nic.
+struct StatsQueryScope {
+	StatsCollector& collector;
+	bool active; // statistiky boli zapnute pri zaciatku operacie
+	StatsQueryScope(StatsCollector& collector, const char* operation) :
+		collector(collector), active(collector.isEnabled())
+	{
+		if(active) collector.beginQuery(operation);
+	}
+	~StatsQueryScope() { if(active) collector.endQuery(); }
+};
+
+// Pomocna struktura, ktora pocas svojej existencie meria jednu fazu operacie.
+// Pri vypnutych statistikach nerobi nic.
+struct StatsPhaseScope {
+	StatsCollector& collector;
+	bool active; // statistiky boli zapnute pri zaciatku fazy
+	double QueryStats::* previous = nullptr;
+	StatsPhaseScope(StatsCollector& collector, double QueryStats::* phase) :
+		collector(collector), active(collector.isEnabled())
+	{
+		if(active) previous = collector.switchPhase(phase);
+	}
+	~StatsPhaseScope() { if(active) collector.switchPhase(previous); }
+};
+
+// Makra pouzivane v grafe. Ocakavaju clena 'stats' typu 'StatsCollector'.
+#define GRAPH_STATS_QUERY(operation) StatsQueryScope statsQueryScope_(this->stats, operation)
+#define GRAPH_STATS_PHASE(phase) StatsPhaseScope statsPhaseScope_##phase(this->stats, &QueryStats::phase##Us)
+#define GRAPH_STATS_COUNT(counter, n) (this->stats.isEnabled() ? (void)(this->stats.current().counter += (n)) : (void)0)
+
+#else
+
+#define GRAPH_STATS_QUERY(operation) ((void)0)
+#define GRAPH_STATS_PHASE(phase) ((void)0)
+#define GRAPH_STATS_COUNT(counter, n) ((void)0)
+
+#endif // GRAPH_STATS
+
+#endif // GRAPH_STATS_H
@@ -4,20 +4,23 @@
 #include <algorithm>
 #include <string>
 #include <list>
+#include <type_traits>
 using namespace std;
 
 // vynimky
 #include "graph_exceptions.h"
 #include "path_exceptions.h"
 
-// Trieda 'Path' reprezentuje cestu v grafe,
-// ktora je tvorena postupnostou hran.
-class Path {
+// Trieda 'BasicPath' reprezentuje cestu v grafe,
+// ktora je tvorena postupnostou hran. Typ 'Length' je
+// typ dlzky hrany (rovnaky ako typ dlzky hrany v grafe).
+template<typename Length = int>
+class BasicPath {
 	// Struktura 'Edge' predstavuje jednu hranu v ceste
 	struct Edge { // jeden usek cesty
 		string endVertexName; // cielovy vrchol
-		int length; // dlzka hrany k cielovemu vrcholu
-		Edge(string endVertexName, int length) :
+		Length length; // dlzka hrany k cielovemu vrcholu
+		Edge(string endVertexName, Length length) :
 			endVertexName(endVertexName),
 			length(length)
 		{}
@@ -26,14 +29,14 @@ class Path {
 	list<Edge> edges; // vsetky hrany cesty okrem startovacieho vrcholu
 public:
 	// Default konstruktor
-	Path() {}
+	BasicPath() {}
 
 	// Konstruktor s parametrom
-	Path(string startVertexName):
+	BasicPath(string startVertexName):
 		startVertexName(startVertexName)
 	{}
 	// Funkcia, ktora prida do cesty na zaciatok novu hranu
-	void addEdgeToFront(string endVertexName, int length) {
+	void addEdgeToFront(string endVertexName, Length length) {
 		this->edges.push_front({ endVertexName,length});
 	}
 	// Funkcia, ktora odstrani poslednu hranu z cesty
@@ -61,6 +64,16 @@ public:
 		return this->edges.empty();
 	}
 
+	// Funkcia, ktora vrati dlzku cesty (sucet dlzok hran). Celociselne
+	// dlzky sa scitavaju v 64 bitoch, rovnako ako vzdialenosti v grafe.
+	conditional_t<is_floating_point<Length>::value, Length, long long> getLength() {
+		conditional_t<is_floating_point<Length>::value, Length, long long> length = 0;
+		for (const Edge& e : this->edges) {
+			length += e.length;
+		}
+		return length;
+	}
+
 	// Funkcia, ktora vrati textovu reprezentaciu cesty.
 	string toString() {
 		string str;
@@ -72,4 +85,7 @@ public:
 	}
 };
 
+// Cesta s celociselnymi dlzkami hran.
+typedef BasicPath<> Path;
+
 #endif // PATH_H